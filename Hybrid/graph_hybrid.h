@@ -0,0 +1,23 @@
+#ifndef GRAPH_LIST_H
+#define GRAPH_LIST_H
+
+// vertex ids and edge weights are stored as these types, define them before including the header
+// to narrow the graph (e.g. uint32_t ids and int32_t weights halve the adjacency memory)
+#ifndef GRAPH_VERTEX_TYPE
+#define GRAPH_VERTEX_TYPE size_t
+#endif
+
+#ifndef GRAPH_WEIGHT_TYPE
+#define GRAPH_WEIGHT_TYPE long long
+#endif
+
+#include "../Unified/runtime_graph.h"
+
+#include "../Listed_Weighted/landmarks.h"
+
+// weighted graph with the interface of Listed_Weighted/graph_list_w.h that keeps adjacency lists while sparse and
+// a matrix once dense (see HybridStorage), directed or not by the constructor's mode. the density thresholds are
+// set through setThresholds, the algorithms live in BasicGraph (Unified/graph_unified.h)
+typedef RuntimeGraph<HybridStorage<GRAPH_VERTEX_TYPE, GRAPH_WEIGHT_TYPE>, true> Graph;
+
+#endif
\ No newline at end of file
@@ -0,0 +1,68 @@
+#ifndef SORTED_ADJACENCY_H
+#define SORTED_ADJACENCY_H
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+
+// Sorted, duplicate-free neighbour array with the interface of std::unordered_set that Graph uses.
+// Up to N neighbours are stored inside the object itself, larger sets move to one heap array.
+template <typename T, size_t N = 4>
+class SortedAdjacency
+{
+    static_assert(std::is_trivially_copyable<T>::value, "SortedAdjacency stores plain vertex ids");
+
+public:
+    typedef T value_type;
+    typedef const T* iterator;
+    typedef const T* const_iterator;
+
+    SortedAdjacency() = default;
+    template <typename It>
+    SortedAdjacency(It first, It last);
+    SortedAdjacency(const SortedAdjacency& other);
+    SortedAdjacency(SortedAdjacency&& other) noexcept;
+
+    ~SortedAdjacency();
+
+    SortedAdjacency& operator=(const SortedAdjacency& other);
+    SortedAdjacency& operator=(SortedAdjacency&& other) noexcept;
+
+    std::pair<iterator, bool> insert(const T& value);
+    size_t erase(const T& value);
+
+    iterator find(const T& value) const;
+    size_t count(const T& value) const;
+
+    iterator begin() const;
+    iterator end() const;
+
+    size_t size() const;
+    bool empty() const;
+
+    void reserve(const size_t& new_space);
+    void clear();
+
+private:
+    bool isLocal() const;
+
+    T* data();
+    const T* data() const;
+
+    uint32_t length = 0;
+    uint32_t space = N;
+
+    union
+    {
+        T local[N];
+        T* heap;
+    };
+};
+
+#include "sorted_adjacency.hpp"
+
+#endif
\ No newline at end of file
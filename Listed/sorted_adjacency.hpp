@@ -0,0 +1,213 @@
+template <typename T, size_t N>
+template <typename It>
+SortedAdjacency<T, N>::SortedAdjacency(It first, It last)
+{
+    for (; first != last; ++first)
+    {
+        if (length == space)
+        {
+            reserve(space * 2);
+        }
+
+        data()[length++] = *first;
+    }
+
+    std::sort(data(), data() + length);
+    length = std::unique(data(), data() + length) - data();
+}
+
+template <typename T, size_t N>
+SortedAdjacency<T, N>::SortedAdjacency(const SortedAdjacency& other)
+{
+    reserve(other.length);
+    std::memcpy(data(), other.data(), other.length * sizeof(T));
+    length = other.length;
+}
+
+template <typename T, size_t N>
+SortedAdjacency<T, N>::SortedAdjacency(SortedAdjacency&& other) noexcept : length(other.length), space(other.space)
+{
+    if (other.isLocal())
+    {
+        std::memcpy(local, other.local, length * sizeof(T));
+    }
+
+    else
+    {
+        heap = other.heap;
+        other.space = N;
+    }
+
+    other.length = 0;
+}
+
+template <typename T, size_t N>
+SortedAdjacency<T, N>::~SortedAdjacency()
+{
+    if (!isLocal())
+    {
+        std::free(heap);
+    }
+}
+
+template <typename T, size_t N>
+SortedAdjacency<T, N>& SortedAdjacency<T, N>::operator=(const SortedAdjacency& other)
+{
+    if (this != &other)
+    {
+        length = 0;
+        reserve(other.length);
+        std::memcpy(data(), other.data(), other.length * sizeof(T));
+        length = other.length;
+    }
+
+    return *this;
+}
+
+template <typename T, size_t N>
+SortedAdjacency<T, N>& SortedAdjacency<T, N>::operator=(SortedAdjacency&& other) noexcept
+{
+    if (this != &other)
+    {
+        this->~SortedAdjacency();
+        new (this) SortedAdjacency(std::move(other));
+    }
+
+    return *this;
+}
+
+template <typename T, size_t N>
+bool SortedAdjacency<T, N>::isLocal() const
+{
+    return space <= N;
+}
+
+template <typename T, size_t N>
+T* SortedAdjacency<T, N>::data()
+{
+    return isLocal() ? local : heap;
+}
+
+template <typename T, size_t N>
+const T* SortedAdjacency<T, N>::data() const
+{
+    return isLocal() ? local : heap;
+}
+
+template <typename T, size_t N>
+std::pair<typename SortedAdjacency<T, N>::iterator, bool> SortedAdjacency<T, N>::insert(const T& value)
+{
+    T* pos = std::lower_bound(data(), data() + length, value);
+    if (pos != data() + length && *pos == value)
+    {
+        return {pos, false};
+    }
+
+    size_t index = pos - data();
+    if (length == space)
+    {
+        reserve(space * 2);
+    }
+
+    T* values = data();
+    std::memmove(values + index + 1, values + index, (length - index) * sizeof(T));
+    values[index] = value;
+    ++length;
+
+    return {values + index, true};
+}
+
+template <typename T, size_t N>
+size_t SortedAdjacency<T, N>::erase(const T& value)
+{
+    T* values = data();
+    T* pos = std::lower_bound(values, values + length, value);
+    if (pos == values + length || *pos != value)
+    {
+        return 0;
+    }
+
+    std::memmove(pos, pos + 1, (values + length - pos - 1) * sizeof(T));
+    --length;
+
+    return 1;
+}
+
+template <typename T, size_t N>
+typename SortedAdjacency<T, N>::iterator SortedAdjacency<T, N>::find(const T& value) const
+{
+    const T* pos = std::lower_bound(begin(), end(), value);
+    if (pos != end() && *pos == value)
+    {
+        return pos;
+    }
+
+    return end();
+}
+
+template <typename T, size_t N>
+size_t SortedAdjacency<T, N>::count(const T& value) const
+{
+    return find(value) != end();
+}
+
+template <typename T, size_t N>
+typename SortedAdjacency<T, N>::iterator SortedAdjacency<T, N>::begin() const
+{
+    return data();
+}
+
+template <typename T, size_t N>
+typename SortedAdjacency<T, N>::iterator SortedAdjacency<T, N>::end() const
+{
+    return data() + length;
+}
+
+template <typename T, size_t N>
+size_t SortedAdjacency<T, N>::size() const
+{
+    return length;
+}
+
+template <typename T, size_t N>
+bool SortedAdjacency<T, N>::empty() const
+{
+    return !length;
+}
+
+template <typename T, size_t N>
+void SortedAdjacency<T, N>::reserve(const size_t& new_space)
+{
+    if (new_space <= space)
+    {
+        return;
+    }
+
+    T* values = static_cast<T*>(std::malloc(new_space * sizeof(T)));
+    if (!values)
+    {
+        throw std::bad_alloc();
+    }
+
+    std::memcpy(values, data(), length * sizeof(T));
+
+    if (!isLocal())
+    {
+        std::free(heap);
+    }
+
+    heap = values;
+    space = new_space;
+}
+
+template <typename T, size_t N>
+void SortedAdjacency<T, N>::clear()
+{
+    if (!isLocal())
+    {
+        std::free(heap);
+    }
+
+    length = 0;
+    space = N;
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+#ifndef BUCKET_QUEUE_H
+#define BUCKET_QUEUE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+// Dial's bucket queue for monotone integer keys that never exceed the last popped (or first pushed) key by more than span - 1
+// (Dijkstra with span = max weight + 1). The span buckets are used circularly, push is O(1) and pop only
+// walks forward over empty buckets. Duplicates are allowed, callers skip stale (key, id) entries themselves.
+class BucketQueue
+{
+public:
+    BucketQueue(const size_t& span);
+
+    bool empty() const;
+    size_t size() const;
+
+    void push(const uint64_t& key, const size_t& id);
+    std::pair<uint64_t, size_t> pop();
+
+private:
+    std::vector<std::vector<size_t>> buckets;
+    uint64_t current = 0;
+    bool started = false;
+    size_t count = 0;
+};
+
+#include "bucket_queue.hpp"
+
+#endif
\ No newline at end of file
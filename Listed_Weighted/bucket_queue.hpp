@@ -0,0 +1,43 @@
+inline BucketQueue::BucketQueue(const size_t& span) : buckets(std::max<size_t>(span, 1))
+{
+}
+
+inline bool BucketQueue::empty() const
+{
+    return !count;
+}
+
+inline size_t BucketQueue::size() const
+{
+    return count;
+}
+
+inline void BucketQueue::push(const uint64_t& key, const size_t& id)
+{
+    // until the first pop the window starts at the first pushed key
+    if (!count && !started)
+    {
+        current = key;
+    }
+
+    buckets[key % buckets.size()].push_back(id);
+    ++count;
+}
+
+inline std::pair<uint64_t, size_t> BucketQueue::pop()
+{
+    started = true;
+
+    while (buckets[current % buckets.size()].empty())
+    {
+        ++current;
+    }
+
+    auto& bucket = buckets[current % buckets.size()];
+
+    size_t id = bucket.back();
+    bucket.pop_back();
+    --count;
+
+    return {current, id};
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+#ifndef FLAT_ADJACENCY_H
+#define FLAT_ADJACENCY_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <utility>
+#include <iterator>
+#include <type_traits>
+
+// Open-addressing (Robin Hood) neighbour -> weight map with the interface of std::unordered_map that Graph uses.
+// Keys and weights live inline in one slot array, iteration walks the slots in order.
+template <typename K, typename V>
+class FlatAdjacency
+{
+public:
+    typedef std::pair<K, V> value_type;
+
+    template <bool Const>
+    class Iterator
+    {
+        public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef std::pair<K, V> value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef std::conditional_t<Const, const value_type*, value_type*> pointer;
+            typedef std::conditional_t<Const, const value_type&, value_type&> reference;
+
+            Iterator() = default;
+            Iterator(pointer slot, const uint8_t* probe, const uint8_t* last) : slot(slot), probe(probe), last(last) { skip(); }
+
+            operator Iterator<true>() const { return Iterator<true>(slot, probe, last); }
+
+            reference operator*() const { return *slot; }
+            pointer operator->() const { return slot; }
+
+            Iterator& operator++() { ++slot; ++probe; skip(); return *this; }
+            Iterator operator++(int) { Iterator tmp = *this; ++*this; return tmp; }
+
+            bool operator==(const Iterator& other) const { return slot == other.slot; }
+            bool operator!=(const Iterator& other) const { return slot != other.slot; }
+
+        private:
+            void skip() { while (probe != last && !*probe) { ++slot; ++probe; } }
+
+            pointer slot = nullptr;
+            const uint8_t* probe = nullptr;
+            const uint8_t* last = nullptr;
+    };
+
+    typedef Iterator<false> iterator;
+    typedef Iterator<true> const_iterator;
+
+    V& operator[](const K& key);
+
+    iterator find(const K& key);
+    const_iterator find(const K& key) const;
+    size_t count(const K& key) const;
+
+    size_t erase(const K& key);
+
+    iterator begin();
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    size_t size() const;
+    bool empty() const;
+
+    void reserve(const size_t& count);
+    void clear();
+
+private:
+    size_t home(const K& key) const;
+    size_t locate(const K& key) const;
+
+    size_t place(K key, V value);
+    void rehash(const size_t& new_space);
+
+    static const size_t npos = -1;
+    static const uint8_t max_probe = 255;
+
+    std::vector<value_type> slots;
+    std::vector<uint8_t> probes; // distance from the home slot + 1, 0 marks an empty slot
+    size_t length = 0;
+    unsigned shift = 64;
+};
+
+#include "flat_adjacency.hpp"
+
+#endif
\ No newline at end of file
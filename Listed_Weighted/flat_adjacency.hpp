@@ -0,0 +1,235 @@
+template <typename K, typename V>
+size_t FlatAdjacency<K, V>::home(const K& key) const
+{
+    // Fibonacci hashing spreads consecutive vertex ids over the whole table
+    return (static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ull) >> shift;
+}
+
+template <typename K, typename V>
+size_t FlatAdjacency<K, V>::locate(const K& key) const
+{
+    if (!length)
+    {
+        return npos;
+    }
+
+    size_t mask = slots.size() - 1;
+    size_t pos = home(key);
+    for (uint8_t dist = 1; probes[pos] >= dist; ++dist)
+    {
+        if (probes[pos] == dist && slots[pos].first == key)
+        {
+            return pos;
+        }
+
+        pos = (pos + 1) & mask;
+    }
+
+    return npos;
+}
+
+template <typename K, typename V>
+size_t FlatAdjacency<K, V>::place(K key, V value)
+{
+    size_t mask = slots.size() - 1;
+    size_t pos = home(key);
+    size_t result = npos;
+    K first = key;
+
+    for (uint8_t dist = 1; ; ++dist)
+    {
+        if (dist == max_probe)
+        {
+            // pathological cluster: grow and put the element we are still carrying back in
+            rehash(slots.size() * 2);
+            place(key, value);
+            return locate(first);
+        }
+
+        if (!probes[pos])
+        {
+            probes[pos] = dist;
+            slots[pos] = {key, value};
+            return result == npos ? pos : result;
+        }
+
+        if (probes[pos] < dist)
+        {
+            std::swap(probes[pos], dist);
+            std::swap(slots[pos].first, key);
+            std::swap(slots[pos].second, value);
+
+            if (result == npos)
+            {
+                result = pos;
+            }
+        }
+
+        pos = (pos + 1) & mask;
+    }
+}
+
+template <typename K, typename V>
+void FlatAdjacency<K, V>::rehash(const size_t& new_space)
+{
+    std::vector<value_type> old_slots(new_space);
+    std::vector<uint8_t> old_probes(new_space, 0);
+
+    old_slots.swap(slots);
+    old_probes.swap(probes);
+
+    shift = 64;
+    for (size_t space = new_space; space > 1; space >>= 1)
+    {
+        --shift;
+    }
+
+    for (size_t i = 0; i < old_slots.size(); ++i)
+    {
+        if (old_probes[i])
+        {
+            place(old_slots[i].first, old_slots[i].second);
+        }
+    }
+}
+
+template <typename K, typename V>
+V& FlatAdjacency<K, V>::operator[](const K& key)
+{
+    size_t pos = locate(key);
+    if (pos != npos)
+    {
+        return slots[pos].second;
+    }
+
+    // keep the load factor under 7/8
+    if ((length + 1) * 8 > slots.size() * 7)
+    {
+        rehash(slots.empty() ? 4 : slots.size() * 2);
+    }
+
+    ++length;
+    return slots[place(key, V())].second;
+}
+
+template <typename K, typename V>
+typename FlatAdjacency<K, V>::iterator FlatAdjacency<K, V>::find(const K& key)
+{
+    size_t pos = locate(key);
+    if (pos == npos)
+    {
+        return end();
+    }
+
+    return iterator(slots.data() + pos, probes.data() + pos, probes.data() + probes.size());
+}
+
+template <typename K, typename V>
+typename FlatAdjacency<K, V>::const_iterator FlatAdjacency<K, V>::find(const K& key) const
+{
+    size_t pos = locate(key);
+    if (pos == npos)
+    {
+        return end();
+    }
+
+    return const_iterator(slots.data() + pos, probes.data() + pos, probes.data() + probes.size());
+}
+
+template <typename K, typename V>
+size_t FlatAdjacency<K, V>::count(const K& key) const
+{
+    return locate(key) != npos;
+}
+
+template <typename K, typename V>
+size_t FlatAdjacency<K, V>::erase(const K& key)
+{
+    size_t pos = locate(key);
+    if (pos == npos)
+    {
+        return 0;
+    }
+
+    // backward shift deletion: pull the following displaced slots one step closer to home
+    size_t mask = slots.size() - 1;
+    size_t next = (pos + 1) & mask;
+    while (probes[next] > 1)
+    {
+        slots[pos] = slots[next];
+        probes[pos] = probes[next] - 1;
+
+        pos = next;
+        next = (next + 1) & mask;
+    }
+
+    probes[pos] = 0;
+    --length;
+
+    return 1;
+}
+
+template <typename K, typename V>
+typename FlatAdjacency<K, V>::iterator FlatAdjacency<K, V>::begin()
+{
+    return iterator(slots.data(), probes.data(), probes.data() + probes.size());
+}
+
+template <typename K, typename V>
+typename FlatAdjacency<K, V>::iterator FlatAdjacency<K, V>::end()
+{
+    return iterator(slots.data() + slots.size(), probes.data() + probes.size(), probes.data() + probes.size());
+}
+
+template <typename K, typename V>
+typename FlatAdjacency<K, V>::const_iterator FlatAdjacency<K, V>::begin() const
+{
+    return const_iterator(slots.data(), probes.data(), probes.data() + probes.size());
+}
+
+template <typename K, typename V>
+typename FlatAdjacency<K, V>::const_iterator FlatAdjacency<K, V>::end() const
+{
+    return const_iterator(slots.data() + slots.size(), probes.data() + probes.size(), probes.data() + probes.size());
+}
+
+template <typename K, typename V>
+size_t FlatAdjacency<K, V>::size() const
+{
+    return length;
+}
+
+template <typename K, typename V>
+bool FlatAdjacency<K, V>::empty() const
+{
+    return !length;
+}
+
+template <typename K, typename V>
+void FlatAdjacency<K, V>::reserve(const size_t& count)
+{
+    if (!count)
+    {
+        return;
+    }
+
+    size_t new_space = 4;
+    while (count * 8 > new_space * 7)
+    {
+        new_space *= 2;
+    }
+
+    if (new_space > slots.size())
+    {
+        rehash(new_space);
+    }
+}
+
+template <typename K, typename V>
+void FlatAdjacency<K, V>::clear()
+{
+    slots = std::vector<value_type>();
+    probes = std::vector<uint8_t>();
+    length = 0;
+    shift = 64;
+}
\ No newline at end of file
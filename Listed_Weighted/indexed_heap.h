@@ -0,0 +1,45 @@
+#ifndef INDEXED_HEAP_H
+#define INDEXED_HEAP_H
+
+#include <cstddef>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+// Min-heap over the ids 0..capacity-1 with an Arity-ary layout and a position index, so every id is in the
+// heap at most once and a smaller key moves the existing entry up instead of pushing a duplicate.
+// Entries are plain (key, id) pairs stored by value, the heap never holds more than capacity of them.
+template <typename Key, size_t Arity = 4>
+class IndexedHeap
+{
+public:
+    IndexedHeap(const size_t& capacity);
+
+    bool empty() const;
+    size_t size() const;
+
+    bool contains(const size_t& id) const;
+    const Key& key(const size_t& id) const;
+
+    // inserts id, or lowers its key if it is already queued, returns false when key is not an improvement
+    bool push(const size_t& id, const Key& key);
+
+    const std::pair<Key, size_t>& top() const;
+    void pop();
+
+    void clear();
+
+private:
+    static constexpr size_t npos = -1;
+
+    void siftUp(size_t pos);
+    void siftDown(size_t pos);
+    void place(const size_t& pos, const std::pair<Key, size_t>& entry);
+
+    std::vector<std::pair<Key, size_t>> heap;
+    std::vector<size_t> positions; // positions[id] is the index of id in heap, npos when it isn't queued
+};
+
+#include "indexed_heap.hpp"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,148 @@
+template <typename Key, size_t Arity>
+IndexedHeap<Key, Arity>::IndexedHeap(const size_t& capacity) : positions(capacity, npos)
+{
+}
+
+template <typename Key, size_t Arity>
+bool IndexedHeap<Key, Arity>::empty() const
+{
+    return heap.empty();
+}
+
+template <typename Key, size_t Arity>
+size_t IndexedHeap<Key, Arity>::size() const
+{
+    return heap.size();
+}
+
+template <typename Key, size_t Arity>
+bool IndexedHeap<Key, Arity>::contains(const size_t& id) const
+{
+    return positions[id] != npos;
+}
+
+template <typename Key, size_t Arity>
+const Key& IndexedHeap<Key, Arity>::key(const size_t& id) const
+{
+    return heap[positions[id]].first;
+}
+
+template <typename Key, size_t Arity>
+bool IndexedHeap<Key, Arity>::push(const size_t& id, const Key& key)
+{
+    if (positions[id] == npos)
+    {
+        positions[id] = heap.size();
+        heap.emplace_back(key, id);
+    }
+    else if (key < heap[positions[id]].first)
+    {
+        heap[positions[id]].first = key;
+    }
+    else
+    {
+        return false;
+    }
+
+    siftUp(positions[id]);
+
+    return true;
+}
+
+template <typename Key, size_t Arity>
+const std::pair<Key, size_t>& IndexedHeap<Key, Arity>::top() const
+{
+    return heap.front();
+}
+
+template <typename Key, size_t Arity>
+void IndexedHeap<Key, Arity>::pop()
+{
+    positions[heap.front().second] = npos;
+
+    if (heap.size() > 1)
+    {
+        place(0, heap.back());
+        heap.pop_back();
+        siftDown(0);
+    }
+    else
+    {
+        heap.pop_back();
+    }
+}
+
+template <typename Key, size_t Arity>
+void IndexedHeap<Key, Arity>::clear()
+{
+    for (auto& entry : heap)
+    {
+        positions[entry.second] = npos;
+    }
+
+    heap.clear();
+}
+
+template <typename Key, size_t Arity>
+void IndexedHeap<Key, Arity>::place(const size_t& pos, const std::pair<Key, size_t>& entry)
+{
+    heap[pos] = entry;
+    positions[entry.second] = pos;
+}
+
+template <typename Key, size_t Arity>
+void IndexedHeap<Key, Arity>::siftUp(size_t pos)
+{
+    std::pair<Key, size_t> entry = heap[pos];
+
+    // the hole moves up and the entry is written once at the end
+    while (pos)
+    {
+        size_t parent = (pos - 1) / Arity;
+        if (!(entry.first < heap[parent].first))
+        {
+            break;
+        }
+
+        place(pos, heap[parent]);
+        pos = parent;
+    }
+
+    place(pos, entry);
+}
+
+template <typename Key, size_t Arity>
+void IndexedHeap<Key, Arity>::siftDown(size_t pos)
+{
+    std::pair<Key, size_t> entry = heap[pos];
+
+    while (true)
+    {
+        size_t first = pos * Arity + 1;
+        if (first >= heap.size())
+        {
+            break;
+        }
+
+        size_t last = std::min(first + Arity, heap.size());
+
+        size_t best = first;
+        for (size_t child = first + 1; child < last; ++child)
+        {
+            if (heap[child].first < heap[best].first)
+            {
+                best = child;
+            }
+        }
+
+        if (!(heap[best].first < entry.first))
+        {
+            break;
+        }
+
+        place(pos, heap[best]);
+        pos = best;
+    }
+
+    place(pos, entry);
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+#ifndef LANDMARKS_H
+#define LANDMARKS_H
+
+#include <cstddef>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <thread>
+#include <atomic>
+
+// ALT lower bounds for A*: for every landmark L the index keeps d(L, v) and d(v, L), by the triangle inequality
+// d(v, t) >= max(d(L, t) - d(L, v), d(v, L) - d(t, L)) and the best landmark gives the estimate.
+// G is either weighted graph, the tables are vertex-major so the bounds of one vertex sit next to each other.
+template <typename G>
+class LandmarkIndex
+{
+public:
+    // Farthest keeps adding the vertex farthest from the landmarks chosen so far, Avoid grows a shortest-path
+    // tree from a random root and descends into the subtree whose current bounds are the worst
+    enum class Selection
+    {
+        Farthest,
+        Avoid
+    };
+
+    LandmarkIndex() = default;
+    LandmarkIndex(const G& graph, const size_t& count, Selection selection = Selection::Farthest,
+                size_t threads = std::thread::hardware_concurrency());
+
+    void build(const G& graph, const size_t& count, Selection selection = Selection::Farthest,
+            size_t threads = std::thread::hardware_concurrency());
+
+    size_t landmarkCount() const;
+    const std::vector<size_t>& landmarks() const;
+
+    // edits can shrink distances and turn stored bounds into overestimates, invalidate takes every landmark out
+    // of the bounds until update (one landmark) or refresh (all stale ones in parallel) recomputes it
+    void invalidate();
+    void update(const G& graph, const size_t& landmark);
+    void refresh(const G& graph, size_t threads = std::thread::hardware_concurrency());
+
+    // lower bound on d(vertex, target), 0 when nothing is known (e.g. vertices added after the last update)
+    long long bound(const size_t& vertex, const size_t& target) const;
+
+    typename G::SearchResult search(const G& graph, const size_t& source, const size_t& target) const;
+
+private:
+    static constexpr long long inf = std::numeric_limits<long long>::max();
+    static constexpr size_t npos = static_cast<size_t>(-1); // no vertex, also a landmark slot not picked yet
+
+    size_t selectAvoid(const G& graph, std::mt19937& rng) const;
+
+    // runs dijkstra from the given landmarks, forward over the out-edges and backward over the in-edges, over threads
+    void compute(const G& graph, const std::vector<size_t>& which, bool forward_too, size_t threads);
+    void store(std::vector<long long>& table, const size_t& landmark, const std::vector<long long>& distances);
+    void grow(const size_t& size);
+
+    std::vector<size_t> chosen;
+    std::vector<bool> fresh;
+
+    std::vector<long long> forward;  // forward[v * landmarkCount() + i] = d(chosen[i], v)
+    std::vector<long long> backward; // backward[v * landmarkCount() + i] = d(v, chosen[i]), empty when undirected
+    size_t vertices = 0;
+    bool directed = false;
+};
+
+#include "landmarks.hpp"
+
+#endif
\ No newline at end of file
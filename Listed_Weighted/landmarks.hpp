@@ -0,0 +1,375 @@
+template <typename G>
+LandmarkIndex<G>::LandmarkIndex(const G& graph, const size_t& count, Selection selection, size_t threads)
+{
+    build(graph, count, selection, threads);
+}
+
+template <typename G>
+void LandmarkIndex<G>::build(const G& graph, const size_t& count, Selection selection, size_t threads)
+{
+    directed = graph.isDirected();
+    vertices = 0;
+    forward.clear();
+    backward.clear();
+
+    chosen.assign(std::min(count, graph.vertexCount()), npos);
+    fresh.assign(chosen.size(), false);
+
+    if (chosen.empty())
+    {
+        return;
+    }
+
+    // fixed seed, so the same graph always gets the same landmarks
+    std::mt19937 rng(0);
+    std::vector<size_t> live = graph.liveVertices();
+    size_t root = live[rng() % live.size()];
+
+    // every pick depends on the forward distances of the previous ones, so the selection runs in order and
+    // only the backward distances are left for the parallel pass
+    for (size_t i = 0; i < chosen.size(); ++i)
+    {
+        size_t next = npos;
+        if (selection == Selection::Avoid)
+        {
+            next = selectAvoid(graph, rng);
+        }
+        else
+        {
+            std::vector<long long> closest = i ? std::vector<long long>(vertices, inf) : graph.dijkstraTree(root).distances;
+            for (size_t v = 0; i && v < vertices; ++v)
+            {
+                for (size_t j = 0; j < i; ++j)
+                {
+                    closest[v] = std::min(closest[v], forward[v * chosen.size() + j]);
+                }
+            }
+
+            // vertices no landmark reaches are skipped, in a disconnected graph they are often isolated ones
+            for (size_t v = 0; v < closest.size(); ++v)
+            {
+                if (closest[v] != inf && std::find(chosen.begin(), chosen.end(), v) == chosen.end() &&
+                    (next == npos || closest[v] > closest[next]))
+                {
+                    next = v;
+                }
+            }
+
+            if (next == npos)
+            {
+                next = selectAvoid(graph, rng);
+            }
+        }
+
+        chosen[i] = next;
+
+        std::vector<long long> distances = graph.dijkstraTree(next).distances;
+        grow(distances.size());
+        store(forward, i, distances);
+    }
+
+    std::vector<size_t> all(chosen.size());
+    for (size_t i = 0; i < all.size(); ++i)
+    {
+        all[i] = i;
+    }
+
+    compute(graph, all, false, threads);
+    fresh.assign(chosen.size(), true);
+}
+
+template <typename G>
+size_t LandmarkIndex<G>::selectAvoid(const G& graph, std::mt19937& rng) const
+{
+    // roots are drawn from the live ids, a removed vertex would give an empty tree
+    std::vector<size_t> live = graph.liveVertices();
+    size_t root = live[rng() % live.size()];
+    auto tree = graph.dijkstraTree(root);
+
+    std::vector<std::vector<size_t>> children(tree.parents.size());
+    for (size_t v = 0; v < tree.parents.size(); ++v)
+    {
+        if (tree.parents[v] != npos)
+        {
+            children[tree.parents[v]].push_back(v);
+        }
+    }
+
+    std::vector<size_t> order = {root};
+    for (size_t pos = 0; pos < order.size(); ++pos)
+    {
+        for (auto& child : children[order[pos]])
+        {
+            order.push_back(child);
+        }
+    }
+
+    // a vertex weighs d(root, v) minus the best bound the chosen landmarks already give for it, a subtree
+    // weighs the sum and drops to 0 once it holds a landmark
+    std::vector<long long> sizes(tree.parents.size(), 0);
+    std::vector<bool> blocked(tree.parents.size(), false);
+    for (auto it = order.rbegin(); it != order.rend(); ++it)
+    {
+        size_t v = *it;
+
+        long long lower = 0;
+        for (size_t j = 0; j < chosen.size() && chosen[j] != npos; ++j)
+        {
+            long long from_root = forward[root * chosen.size() + j];
+            long long from_v = forward[v * chosen.size() + j];
+            if (from_root != inf && from_v != inf)
+            {
+                lower = std::max(lower, directed ? from_v - from_root : std::max(from_v - from_root, from_root - from_v));
+            }
+        }
+
+        sizes[v] = tree.distances[v] - lower;
+        blocked[v] = std::find(chosen.begin(), chosen.end(), v) != chosen.end();
+
+        for (auto& child : children[v])
+        {
+            blocked[v] = blocked[v] || blocked[child];
+            sizes[v] += sizes[child];
+        }
+
+        if (blocked[v])
+        {
+            sizes[v] = 0;
+        }
+    }
+
+    size_t curr = root;
+    while (true)
+    {
+        size_t heaviest = npos;
+        for (auto& child : children[curr])
+        {
+            if (sizes[child] > 0 && (heaviest == npos || sizes[child] > sizes[heaviest]))
+            {
+                heaviest = child;
+            }
+        }
+
+        if (heaviest == npos)
+        {
+            break;
+        }
+
+        curr = heaviest;
+    }
+
+    if (sizes[root] > 0)
+    {
+        return curr;
+    }
+
+    // nothing left to gain around root: take the farthest free vertex it reaches, or any free one
+    size_t result = npos;
+    for (auto& v : order)
+    {
+        if (std::find(chosen.begin(), chosen.end(), v) == chosen.end() &&
+            (result == npos || tree.distances[v] > tree.distances[result]))
+        {
+            result = v;
+        }
+    }
+
+    for (size_t pos = 0; result == npos; ++pos)
+    {
+        if (std::find(chosen.begin(), chosen.end(), live[pos]) == chosen.end())
+        {
+            result = live[pos];
+        }
+    }
+
+    return result;
+}
+
+template <typename G>
+void LandmarkIndex<G>::compute(const G& graph, const std::vector<size_t>& which, bool forward_too, size_t threads)
+{
+    // backward distances come from the in-edges when the graph tracks them, otherwise from one transposed copy
+    // shared by all the jobs
+    bool copy = directed && !graph.tracksIncoming();
+
+    G reversed;
+    if (copy)
+    {
+        reversed = graph;
+        reversed.transpose();
+    }
+
+    // (landmark, backward) pairs, every job is one dijkstra writing one column of a table
+    std::vector<std::pair<size_t, bool>> jobs;
+    for (auto& landmark : which)
+    {
+        if (forward_too)
+        {
+            jobs.push_back({landmark, false});
+        }
+
+        if (directed)
+        {
+            jobs.push_back({landmark, true});
+        }
+    }
+
+    if (jobs.empty())
+    {
+        return;
+    }
+
+    auto run = [&](const std::pair<size_t, bool>& job)
+    {
+        if (!job.second)
+        {
+            return graph.dijkstraTree(chosen[job.first]).distances;
+        }
+
+        return copy ? reversed.dijkstraTree(chosen[job.first]).distances : graph.dijkstraTreeTo(chosen[job.first]).distances;
+    };
+
+    // the first job runs alone, its size tells how large the tables have to be before the others write into them
+    std::vector<long long> distances = run(jobs[0]);
+    grow(distances.size());
+    store(jobs[0].second ? backward : forward, jobs[0].first, distances);
+
+    std::atomic<size_t> next = 1;
+    auto worker = [&]()
+    {
+        for (size_t pos = next++; pos < jobs.size(); pos = next++)
+        {
+            store(jobs[pos].second ? backward : forward, jobs[pos].first, run(jobs[pos]));
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (size_t t = 1; t < std::min(threads, jobs.size() - 1); ++t)
+    {
+        pool.emplace_back(worker);
+    }
+
+    worker();
+
+    for (auto& thread : pool)
+    {
+        thread.join();
+    }
+}
+
+template <typename G>
+void LandmarkIndex<G>::store(std::vector<long long>& table, const size_t& landmark, const std::vector<long long>& distances)
+{
+    for (size_t v = 0; v < distances.size(); ++v)
+    {
+        table[v * chosen.size() + landmark] = distances[v];
+    }
+}
+
+template <typename G>
+void LandmarkIndex<G>::grow(const size_t& size)
+{
+    if (size <= vertices)
+    {
+        return;
+    }
+
+    // rows are vertex-major, so the existing ones keep their place and new vertices start out unknown
+    vertices = size;
+    forward.resize(vertices * chosen.size(), inf);
+    if (directed)
+    {
+        backward.resize(vertices * chosen.size(), inf);
+    }
+}
+
+template <typename G>
+size_t LandmarkIndex<G>::landmarkCount() const
+{
+    return chosen.size();
+}
+
+template <typename G>
+const std::vector<size_t>& LandmarkIndex<G>::landmarks() const
+{
+    return chosen;
+}
+
+template <typename G>
+void LandmarkIndex<G>::invalidate()
+{
+    fresh.assign(chosen.size(), false);
+}
+
+template <typename G>
+void LandmarkIndex<G>::update(const G& graph, const size_t& landmark)
+{
+    compute(graph, {landmark}, true, 2);
+    fresh[landmark] = true;
+}
+
+template <typename G>
+void LandmarkIndex<G>::refresh(const G& graph, size_t threads)
+{
+    std::vector<size_t> stale;
+    for (size_t i = 0; i < chosen.size(); ++i)
+    {
+        if (!fresh[i])
+        {
+            stale.push_back(i);
+        }
+    }
+
+    compute(graph, stale, true, threads);
+
+    for (auto& i : stale)
+    {
+        fresh[i] = true;
+    }
+}
+
+template <typename G>
+long long LandmarkIndex<G>::bound(const size_t& vertex, const size_t& target) const
+{
+    if (vertex >= vertices || target >= vertices)
+    {
+        return 0;
+    }
+
+    // undirected graphs only keep the forward table, d(v, L) is d(L, v) there
+    const std::vector<long long>& to_landmark = directed ? backward : forward;
+    const long long* from_v = forward.data() + vertex * chosen.size();
+    const long long* from_t = forward.data() + target * chosen.size();
+    const long long* v_to = to_landmark.data() + vertex * chosen.size();
+    const long long* t_to = to_landmark.data() + target * chosen.size();
+
+    long long result = 0;
+    for (size_t i = 0; i < chosen.size(); ++i)
+    {
+        if (!fresh[i])
+        {
+            continue;
+        }
+
+        if (from_t[i] != inf && from_v[i] != inf)
+        {
+            result = std::max(result, from_t[i] - from_v[i]);
+        }
+
+        if (v_to[i] != inf && t_to[i] != inf)
+        {
+            result = std::max(result, v_to[i] - t_to[i]);
+        }
+    }
+
+    return result;
+}
+
+template <typename G>
+typename G::SearchResult LandmarkIndex<G>::search(const G& graph, const size_t& source, const size_t& target) const
+{
+    return graph.astar(source, target, [&](const size_t& vertex)
+    {
+        return bound(vertex, target);
+    });
+}
\ No newline at end of file
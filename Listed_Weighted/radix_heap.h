@@ -0,0 +1,36 @@
+#ifndef RADIX_HEAP_H
+#define RADIX_HEAP_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <bit>
+
+// Monotone radix heap: pushed keys may never be smaller than the last popped one (true for Dijkstra with
+// non-negative integer weights). Bucket b holds the keys whose highest bit differing from the last popped
+// key is b - 1, so each entry is moved at most 64 times over its lifetime and no comparisons are needed.
+// Duplicates are allowed, callers skip stale (key, id) entries themselves.
+class RadixHeap
+{
+public:
+    RadixHeap() = default;
+
+    bool empty() const;
+    size_t size() const;
+
+    void push(const uint64_t& key, const size_t& id);
+    std::pair<uint64_t, size_t> pop();
+
+private:
+    static size_t bucket(const uint64_t& key, const uint64_t& last);
+
+    std::vector<std::pair<uint64_t, size_t>> buckets[65];
+    uint64_t last = 0;
+    size_t count = 0;
+};
+
+#include "radix_heap.hpp"
+
+#endif
\ No newline at end of file
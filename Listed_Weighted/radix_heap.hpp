@@ -0,0 +1,53 @@
+inline bool RadixHeap::empty() const
+{
+    return !count;
+}
+
+inline size_t RadixHeap::size() const
+{
+    return count;
+}
+
+inline size_t RadixHeap::bucket(const uint64_t& key, const uint64_t& last)
+{
+    return key == last ? 0 : 64 - std::countl_zero(key ^ last);
+}
+
+inline void RadixHeap::push(const uint64_t& key, const size_t& id)
+{
+    buckets[bucket(key, last)].emplace_back(key, id);
+    ++count;
+}
+
+inline std::pair<uint64_t, size_t> RadixHeap::pop()
+{
+    if (buckets[0].empty())
+    {
+        size_t b = 1;
+        while (buckets[b].empty())
+        {
+            ++b;
+        }
+
+        // the smallest key of the first non-empty bucket becomes the new base, every entry of that
+        // bucket then shares more leading bits with it and lands in a lower bucket
+        last = buckets[b].front().first;
+        for (auto& entry : buckets[b])
+        {
+            last = std::min(last, entry.first);
+        }
+
+        for (auto& entry : buckets[b])
+        {
+            buckets[bucket(entry.first, last)].push_back(entry);
+        }
+
+        buckets[b].clear();
+    }
+
+    auto entry = buckets[0].back();
+    buckets[0].pop_back();
+    --count;
+
+    return entry;
+}
\ No newline at end of file
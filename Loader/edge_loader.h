@@ -0,0 +1,41 @@
+#ifndef EDGE_LOADER_H
+#define EDGE_LOADER_H
+
+#include <vector>
+#include <tuple>
+#include <utility>
+#include <string>
+#include <thread>
+#include <charconv>
+#include <cstring>
+#include <type_traits>
+#include <algorithm>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// text edge lists in the SNAP/TSV style: one "src dst [weight]" per line, fields separated by spaces, tabs
+// or commas, lines starting with '#' or '%' and blank lines are skipped, a missing weight counts as 1 and
+// columns after the weight are ignored.
+// the file is mapped and cut into one chunk per thread at line boundaries, every chunk is parsed with
+// std::from_chars and the chunks are joined in file order, so repeated edges resolve exactly as in addEdge
+
+// Edge is std::pair<size_t, size_t> (weights are ignored) or std::tuple<size_t, size_t, size_t>,
+// returns false if the file can't be read, a line doesn't start with two integers or one of the integers
+// runs into other characters (a fractional weight like 2.5 is rejected, not truncated)
+template <typename Edge>
+bool loadEdges(const std::string& path, std::vector<Edge>& edges, size_t threads = std::thread::hardware_concurrency());
+
+// builds any of the graphs from the file with the parallel constructor, mode is ignored by BasicGraph,
+// which fixes directedness in its type
+template <typename G>
+bool loadGraph(const std::string& path, G& graph, bool mode = 0, size_t threads = std::thread::hardware_concurrency());
+
+template <typename Edge>
+bool parseEdges(const char* begin, const char* end, std::vector<Edge>& edges);
+
+#include "edge_loader.hpp"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,199 @@
+template <typename Edge>
+bool parseEdges(const char* begin, const char* end, std::vector<Edge>& edges)
+{
+    auto separator = [](const char& c) -> bool
+    {
+        return c == ' ' || c == '\t' || c == ',' || c == '\r';
+    };
+
+    // from_chars stops at the first character it can't use, so "2.5" would read as 2 without this check
+    auto parsed = [&](const std::from_chars_result& result, const char* line_end) -> bool
+    {
+        return result.ec == std::errc() && (result.ptr == line_end || separator(*result.ptr));
+    };
+
+    while (begin < end)
+    {
+        const char* line_end = static_cast<const char*>(std::memchr(begin, '\n', end - begin));
+        if (!line_end)
+        {
+            line_end = end;
+        }
+
+        const char* pos = begin;
+        begin = line_end + 1;
+
+        while (pos < line_end && separator(*pos))
+        {
+            ++pos;
+        }
+
+        if (pos == line_end || *pos == '#' || *pos == '%')
+        {
+            continue;
+        }
+
+        size_t index1 = 0;
+        size_t index2 = 0;
+
+        auto result1 = std::from_chars(pos, line_end, index1);
+        if (!parsed(result1, line_end))
+        {
+            return false;
+        }
+
+        pos = result1.ptr;
+        while (pos < line_end && separator(*pos))
+        {
+            ++pos;
+        }
+
+        auto result2 = std::from_chars(pos, line_end, index2);
+        if (!parsed(result2, line_end))
+        {
+            return false;
+        }
+
+        if constexpr (std::tuple_size_v<Edge> == 3)
+        {
+            pos = result2.ptr;
+            while (pos < line_end && separator(*pos))
+            {
+                ++pos;
+            }
+
+            // weights are parsed signed and stored in the size_t slot, the graphs convert them back to their weight_type
+            long long w = 1;
+            if (pos < line_end && !parsed(std::from_chars(pos, line_end, w), line_end))
+            {
+                return false;
+            }
+
+            edges.emplace_back(index1, index2, static_cast<size_t>(w));
+        }
+        else
+        {
+            edges.emplace_back(index1, index2);
+        }
+    }
+
+    return true;
+}
+
+template <typename Edge>
+bool loadEdges(const std::string& path, std::vector<Edge>& edges, size_t threads)
+{
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) == -1)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    size_t length = info.st_size;
+    if (!length)
+    {
+        ::close(fd);
+        edges.clear();
+        return true;
+    }
+
+    void* data = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+
+    if (data == MAP_FAILED)
+    {
+        return false;
+    }
+
+    madvise(data, length, MADV_SEQUENTIAL);
+
+    const char* text = static_cast<const char*>(data);
+    size_t count = std::max<size_t>(1, std::min(threads, length));
+
+    // every chunk starts right after a newline, so no line is split between two threads
+    std::vector<const char*> bounds(count + 1, text + length);
+    bounds[0] = text;
+    for (size_t t = 1; t < count; ++t)
+    {
+        const char* pos = std::max(text + length * t / count, bounds[t - 1]);
+        const char* newline = static_cast<const char*>(std::memchr(pos, '\n', text + length - pos));
+        bounds[t] = newline ? newline + 1 : text + length;
+    }
+
+    std::vector<std::vector<Edge>> parts(count);
+    std::vector<char> valid(count, true);
+
+    std::vector<std::thread> pool;
+    for (size_t t = 1; t < count; ++t)
+    {
+        pool.emplace_back([&, t]()
+        {
+            valid[t] = parseEdges(bounds[t], bounds[t + 1], parts[t]);
+        });
+    }
+
+    valid[0] = parseEdges(bounds[0], bounds[1], parts[0]);
+
+    for (auto& thread : pool)
+    {
+        thread.join();
+    }
+
+    munmap(data, length);
+
+    if (std::find(valid.begin(), valid.end(), false) != valid.end())
+    {
+        return false;
+    }
+
+    size_t total = 0;
+    for (auto& part : parts)
+    {
+        total += part.size();
+    }
+
+    edges.clear();
+    edges.reserve(total);
+    for (auto& part : parts)
+    {
+        edges.insert(edges.end(), part.begin(), part.end());
+        std::vector<Edge>().swap(part);
+    }
+
+    return true;
+}
+
+template <typename G>
+bool loadGraph(const std::string& path, G& graph, bool mode, size_t threads)
+{
+    typedef std::vector<std::tuple<size_t, size_t, size_t>> weighted_edges;
+    typedef std::vector<std::pair<size_t, size_t>> edges_type;
+
+    // the weighted graphs take (src, dst, w) tuples, the others plain pairs
+    typedef std::conditional_t<G::weighted, weighted_edges, edges_type> list_type;
+
+    list_type edges;
+    if (!loadEdges(path, edges, threads))
+    {
+        return false;
+    }
+
+    if constexpr (std::is_constructible_v<G, const list_type&, bool, size_t>)
+    {
+        graph = G(edges, mode, threads);
+    }
+    else
+    {
+        // BasicGraph fixes directedness in its type
+        graph = G(edges, threads);
+    }
+
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,45 @@
+#ifndef GRAPH_FORMAT_H
+#define GRAPH_FORMAT_H
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <utility>
+
+// binary graph file, native byte order:
+//   GraphFileHeader
+//   offsets  uint64_t[vertices + 1], offsets[i]..offsets[i + 1] is the range of vertex i
+//   targets  vertex id[edges]
+//   weights  weight[edges], weighted graphs only
+// every section starts on a 64 byte boundary, so a mapped file can be read in place
+
+struct GraphFileHeader
+{
+    static constexpr char MAGIC[8] = {'G', 'R', 'A', 'P', 'H', 'B', 'I', 'N'};
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint64_t ALIGNMENT = 64;
+
+    static constexpr uint32_t DIRECTED = 1;
+    static constexpr uint32_t WEIGHTED = 2;
+
+    char magic[8];
+    uint32_t version;
+    uint32_t flags;
+    uint32_t vertex_bytes;
+    uint32_t weight_bytes; // 0 for unweighted graphs
+    uint64_t vertices;
+    uint64_t edges;
+    uint64_t offsets_at;
+    uint64_t targets_at;
+    uint64_t weights_at;
+};
+
+// row(i, out) appends the (target, weight) pairs of vertex i to out, it is called once per vertex in order,
+// the targets are written as the rows come and the weights are kept until the targets section is complete
+template <typename VertexId, typename Weight, typename Row>
+bool writeGraphFile(const std::string& path, const size_t& vertices, bool directed, bool weighted, Row row);
+
+#include "graph_format.hpp"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,91 @@
+template <typename VertexId, typename Weight, typename Row>
+bool writeGraphFile(const std::string& path, const size_t& vertices, bool directed, bool weighted, Row row)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        return false;
+    }
+
+    auto align = [](const uint64_t& pos) -> uint64_t
+    {
+        return (pos + GraphFileHeader::ALIGNMENT - 1) / GraphFileHeader::ALIGNMENT * GraphFileHeader::ALIGNMENT;
+    };
+
+    uint64_t written = 0;
+    auto write = [&](const void* data, const uint64_t& size)
+    {
+        file.write(static_cast<const char*>(data), size);
+        written += size;
+    };
+
+    auto pad = [&](const uint64_t& pos)
+    {
+        static const char zeros[GraphFileHeader::ALIGNMENT] = {};
+        write(zeros, pos - written);
+    };
+
+    GraphFileHeader header = {};
+    std::copy(GraphFileHeader::MAGIC, GraphFileHeader::MAGIC + 8, header.magic);
+    header.version = GraphFileHeader::VERSION;
+    header.flags = (directed ? GraphFileHeader::DIRECTED : 0) | (weighted ? GraphFileHeader::WEIGHTED : 0);
+    header.vertex_bytes = sizeof(VertexId);
+    header.weight_bytes = weighted ? sizeof(Weight) : 0;
+    header.vertices = vertices;
+    header.offsets_at = align(sizeof(GraphFileHeader));
+    header.targets_at = align(header.offsets_at + (vertices + 1) * sizeof(uint64_t));
+
+    // the header and offsets are only known once every row was seen, so they are written as placeholders
+    // and filled in at the end, targets stream straight to the file and only the weights wait in memory
+    std::vector<uint64_t> offsets(vertices + 1, 0);
+
+    write(&header, sizeof(header));
+
+    pad(header.offsets_at);
+    write(offsets.data(), offsets.size() * sizeof(uint64_t));
+
+    pad(header.targets_at);
+
+    std::vector<std::pair<VertexId, Weight>> buffer;
+    std::vector<VertexId> targets;
+    std::vector<Weight> weights;
+    for (size_t i = 0; i < vertices; ++i)
+    {
+        buffer.clear();
+        row(i, buffer);
+
+        offsets[i + 1] = offsets[i] + buffer.size();
+
+        targets.clear();
+        for (auto& elem : buffer)
+        {
+            targets.push_back(elem.first);
+            if (weighted)
+            {
+                weights.push_back(elem.second);
+            }
+        }
+
+        write(targets.data(), targets.size() * sizeof(VertexId));
+    }
+
+    header.edges = offsets.back();
+
+    if (weighted)
+    {
+        header.weights_at = align(header.targets_at + header.edges * sizeof(VertexId));
+
+        pad(header.weights_at);
+        write(weights.data(), weights.size() * sizeof(Weight));
+    }
+
+    file.seekp(0);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    file.seekp(header.offsets_at);
+    file.write(reinterpret_cast<const char*>(offsets.data()), offsets.size() * sizeof(uint64_t));
+
+    file.close();
+
+    return !file.fail();
+}
\ No newline at end of file
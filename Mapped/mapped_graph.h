@@ -0,0 +1,85 @@
+#ifndef MAPPED_GRAPH_H
+#define MAPPED_GRAPH_H
+
+#include <iostream>
+#include <vector>
+#include <stack>
+#include <queue>
+#include <utility>
+#include <algorithm>
+#include <limits>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "graph_format.h"
+#include "../Listed_Weighted/indexed_heap.h"
+
+// read-only graph over a file written by save(), the traversals run straight on the mapped pages so
+// opening costs no parsing and processes mapping the same file share one copy through the page cache.
+// VertexId and Weight have to match the vertex_type and weight_type of the graph that wrote the file
+template <typename VertexId = size_t, typename Weight = long long>
+class MappedGraph
+{
+public:
+    typedef VertexId vertex_type;
+    typedef Weight weight_type;
+
+    MappedGraph() = default;
+    MappedGraph(const std::string& path);
+    MappedGraph(const MappedGraph& gr) = delete;
+    MappedGraph(MappedGraph&& gr) noexcept;
+
+    ~MappedGraph();
+
+    MappedGraph& operator=(const MappedGraph& gr) = delete;
+    MappedGraph& operator=(MappedGraph&& gr) noexcept;
+
+    // open only checks the header and that the sections lie inside the file, so a cold start touches a few
+    // pages instead of the whole graph. the traversals trust the rows, run validate() first on files that
+    // may be corrupt or hostile
+    bool open(const std::string& path);
+    void close();
+
+    // one pass over the offsets and targets: every row is a range inside targets and every target a vertex
+    bool validate() const;
+
+    bool isOpen() const;
+    bool isDirected() const;
+    bool isWeighted() const;
+
+    size_t vertexCount() const;
+    size_t edgeCount() const;
+
+    void printDfsIterative(const size_t& index) const;
+    void printBfs(const size_t& index) const;
+
+    std::vector<size_t> getShortPath(const size_t& source, size_t dest) const;
+
+    std::vector<size_t> topoKahn() const;
+    std::vector<std::vector<size_t>> tarjan() const;
+
+    std::vector<long long> SSSP(const size_t& source) const;
+    std::vector<std::pair<std::vector<size_t>, long long>> dijkstra(const size_t& source) const;
+
+private:
+    static constexpr size_t npos = static_cast<size_t>(-1); // no parent
+
+    long long weight(const size_t& pos) const;
+    std::vector<size_t> constructPath(const std::vector<size_t>& parents, size_t dest) const;
+
+    void* data = nullptr;
+    size_t length = 0;
+
+    const GraphFileHeader* header = nullptr;
+    const uint64_t* offsets = nullptr;
+    const vertex_type* targets = nullptr;
+    const weight_type* weights = nullptr; // nullptr for unweighted files, every edge then weighs 1
+};
+
+#include "mapped_graph.hpp"
+
+#endif
\ No newline at end of file
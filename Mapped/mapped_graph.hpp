@@ -0,0 +1,501 @@
+template <typename VertexId, typename Weight>
+MappedGraph<VertexId, Weight>::MappedGraph(const std::string& path)
+{
+    open(path);
+}
+
+template <typename VertexId, typename Weight>
+MappedGraph<VertexId, Weight>::MappedGraph(MappedGraph&& gr) noexcept
+{
+    *this = std::move(gr);
+}
+
+template <typename VertexId, typename Weight>
+MappedGraph<VertexId, Weight>::~MappedGraph()
+{
+    close();
+}
+
+template <typename VertexId, typename Weight>
+MappedGraph<VertexId, Weight>& MappedGraph<VertexId, Weight>::operator=(MappedGraph&& gr) noexcept
+{
+    if (this != &gr)
+    {
+        close();
+
+        std::swap(data, gr.data);
+        std::swap(length, gr.length);
+        std::swap(header, gr.header);
+        std::swap(offsets, gr.offsets);
+        std::swap(targets, gr.targets);
+        std::swap(weights, gr.weights);
+    }
+
+    return *this;
+}
+
+template <typename VertexId, typename Weight>
+bool MappedGraph<VertexId, Weight>::open(const std::string& path)
+{
+    close();
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) == -1 || static_cast<uint64_t>(info.st_size) < sizeof(GraphFileHeader))
+    {
+        ::close(fd);
+        return false;
+    }
+
+    length = info.st_size;
+    data = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+
+    // the mapping keeps its own reference to the file
+    ::close(fd);
+
+    if (data == MAP_FAILED)
+    {
+        data = nullptr;
+        length = 0;
+        return false;
+    }
+
+    const char* base = static_cast<const char*>(data);
+    header = reinterpret_cast<const GraphFileHeader*>(base);
+
+    bool weighted = header->flags & GraphFileHeader::WEIGHTED;
+
+    // count elements of size bytes at `at` lie inside the file and are aligned for their type (the mapping
+    // itself is page aligned), written as divisions so a hostile header can't overflow the sums
+    auto section = [&](const uint64_t& at, const uint64_t& count, const uint64_t& size, const uint64_t& align)
+    {
+        return at % align == 0 && at >= sizeof(GraphFileHeader) && at <= length && count <= (length - at) / size;
+    };
+
+    bool valid = std::equal(GraphFileHeader::MAGIC, GraphFileHeader::MAGIC + 8, header->magic) &&
+                 header->version == GraphFileHeader::VERSION &&
+                 header->vertex_bytes == sizeof(vertex_type) &&
+                 header->weight_bytes == (weighted ? sizeof(weight_type) : 0) &&
+                 header->vertices < length / sizeof(uint64_t) &&
+                 section(header->offsets_at, header->vertices + 1, sizeof(uint64_t), alignof(uint64_t)) &&
+                 section(header->targets_at, header->edges, sizeof(vertex_type), alignof(vertex_type)) &&
+                 (!weighted || section(header->weights_at, header->edges, sizeof(weight_type), alignof(weight_type)));
+
+    // only the ends of the offsets here, the rows in between are left to validate()
+    if (valid)
+    {
+        offsets = reinterpret_cast<const uint64_t*>(base + header->offsets_at);
+        valid = offsets[0] == 0 && offsets[header->vertices] == header->edges;
+    }
+
+    if (!valid)
+    {
+        close();
+        return false;
+    }
+
+    targets = reinterpret_cast<const vertex_type*>(base + header->targets_at);
+    weights = weighted ? reinterpret_cast<const weight_type*>(base + header->weights_at) : nullptr;
+
+    return true;
+}
+
+template <typename VertexId, typename Weight>
+void MappedGraph<VertexId, Weight>::close()
+{
+    if (data)
+    {
+        munmap(data, length);
+    }
+
+    data = nullptr;
+    length = 0;
+    header = nullptr;
+    offsets = nullptr;
+    targets = nullptr;
+    weights = nullptr;
+}
+
+template <typename VertexId, typename Weight>
+bool MappedGraph<VertexId, Weight>::validate() const
+{
+    if (!header)
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < header->vertices; ++i)
+    {
+        if (offsets[i] > offsets[i + 1])
+        {
+            return false;
+        }
+    }
+
+    for (size_t pos = 0; pos < header->edges; ++pos)
+    {
+        if (static_cast<uint64_t>(targets[pos]) >= header->vertices)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename VertexId, typename Weight>
+bool MappedGraph<VertexId, Weight>::isOpen() const
+{
+    return data;
+}
+
+template <typename VertexId, typename Weight>
+bool MappedGraph<VertexId, Weight>::isDirected() const
+{
+    return header && header->flags & GraphFileHeader::DIRECTED;
+}
+
+template <typename VertexId, typename Weight>
+bool MappedGraph<VertexId, Weight>::isWeighted() const
+{
+    return weights;
+}
+
+template <typename VertexId, typename Weight>
+size_t MappedGraph<VertexId, Weight>::vertexCount() const
+{
+    return header ? header->vertices : 0;
+}
+
+template <typename VertexId, typename Weight>
+size_t MappedGraph<VertexId, Weight>::edgeCount() const
+{
+    return header ? header->edges : 0;
+}
+
+template <typename VertexId, typename Weight>
+long long MappedGraph<VertexId, Weight>::weight(const size_t& pos) const
+{
+    return weights ? weights[pos] : 1;
+}
+
+template <typename VertexId, typename Weight>
+std::vector<size_t> MappedGraph<VertexId, Weight>::constructPath(const std::vector<size_t>& parents, size_t dest) const
+{
+    std::vector<size_t> result;
+    for (; dest != npos; dest = parents[dest])
+    {
+        result.push_back(dest);
+    }
+
+    std::reverse(result.begin(), result.end());
+
+    return result;
+}
+
+template <typename VertexId, typename Weight>
+void MappedGraph<VertexId, Weight>::printDfsIterative(const size_t& index) const
+{
+    std::stack<size_t> indexes;
+    indexes.push(index);
+
+    std::vector<bool> visited(vertexCount(), false);
+    visited[index] = true;
+
+    while (!indexes.empty())
+    {
+        size_t curr = indexes.top();
+        indexes.pop();
+
+        std::cout << curr << ' ';
+
+        for (size_t pos = offsets[curr]; pos < offsets[curr + 1]; ++pos)
+        {
+            if (!visited[targets[pos]])
+            {
+                visited[targets[pos]] = true;
+                indexes.push(targets[pos]);
+            }
+        }
+    }
+
+    std::cout << std::endl;
+}
+
+template <typename VertexId, typename Weight>
+void MappedGraph<VertexId, Weight>::printBfs(const size_t& index) const
+{
+    std::queue<size_t> indexes;
+    indexes.push(index);
+
+    std::vector<bool> visited(vertexCount(), false);
+    visited[index] = true;
+
+    size_t size = 1;
+    size_t new_size = 0;
+    while (!indexes.empty())
+    {
+        size_t curr = indexes.front();
+        indexes.pop();
+
+        std::cout << curr << ' ';
+
+        for (size_t pos = offsets[curr]; pos < offsets[curr + 1]; ++pos)
+        {
+            if (!visited[targets[pos]])
+            {
+                ++new_size;
+                visited[targets[pos]] = true;
+                indexes.push(targets[pos]);
+            }
+        }
+
+        --size;
+        if (!size)
+        {
+            size = new_size;
+            new_size = 0;
+            std::cout << std::endl;
+        }
+    }
+
+    std::cout << std::endl;
+}
+
+template <typename VertexId, typename Weight>
+std::vector<size_t> MappedGraph<VertexId, Weight>::getShortPath(const size_t& source, size_t dest) const
+{
+    std::queue<size_t> indexes;
+    indexes.push(source);
+
+    std::vector<size_t> parent(vertexCount(), npos);
+    std::vector<bool> seen(vertexCount(), false);
+    seen[source] = true;
+
+    while (!indexes.empty())
+    {
+        size_t curr = indexes.front();
+        indexes.pop();
+
+        if (curr == dest)
+        {
+            return constructPath(parent, dest);
+        }
+
+        for (size_t pos = offsets[curr]; pos < offsets[curr + 1]; ++pos)
+        {
+            if (!seen[targets[pos]])
+            {
+                seen[targets[pos]] = true;
+                parent[targets[pos]] = curr;
+                indexes.push(targets[pos]);
+            }
+        }
+    }
+
+    return std::vector<size_t>();
+}
+
+template <typename VertexId, typename Weight>
+std::vector<size_t> MappedGraph<VertexId, Weight>::topoKahn() const
+{
+    size_t size = vertexCount();
+
+    std::vector<size_t> parent(size, 0);
+    for (size_t pos = 0; pos < edgeCount(); ++pos)
+    {
+        ++parent[targets[pos]];
+    }
+
+    std::vector<size_t> result;
+    result.reserve(size);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        if (!parent[i])
+        {
+            result.push_back(i);
+        }
+    }
+
+    // result doubles as the queue: everything after head is still waiting to be expanded
+    for (size_t head = 0; head < result.size(); ++head)
+    {
+        size_t curr = result[head];
+        for (size_t pos = offsets[curr]; pos < offsets[curr + 1]; ++pos)
+        {
+            if (!--parent[targets[pos]])
+            {
+                result.push_back(targets[pos]);
+            }
+        }
+    }
+
+    if (result.size() != size)
+    {
+        return std::vector<size_t>();
+    }
+
+    return result;
+}
+
+template <typename VertexId, typename Weight>
+std::vector<std::vector<size_t>> MappedGraph<VertexId, Weight>::tarjan() const
+{
+    size_t size = vertexCount();
+
+    std::vector<long long> ip_vec(size, -1);
+    std::vector<long long> ll_vec(size, -1);
+
+    std::vector<bool> visited(size, false);
+    std::stack<size_t> st;
+
+    std::vector<std::vector<size_t>> result;
+
+    // explicit (vertex, next edge) stack instead of recursion, mapped graphs are usually too big for the call stack
+    std::vector<std::pair<size_t, size_t>> calls;
+
+    size_t ip = 0;
+    for (size_t i = 0; i < size; ++i)
+    {
+        if (ip_vec[i] != -1)
+        {
+            continue;
+        }
+
+        ip_vec[i] = ll_vec[i] = ip++;
+        st.push(i);
+        visited[i] = true;
+        calls.emplace_back(i, offsets[i]);
+
+        while (!calls.empty())
+        {
+            auto& [index, pos] = calls.back();
+            if (pos < offsets[index + 1])
+            {
+                size_t elem = targets[pos++];
+                if (ip_vec[elem] == -1)
+                {
+                    ip_vec[elem] = ll_vec[elem] = ip++;
+                    st.push(elem);
+                    visited[elem] = true;
+                    calls.emplace_back(elem, offsets[elem]);
+                }
+
+                else if (visited[elem])
+                {
+                    ll_vec[index] = std::min(ll_vec[index], ll_vec[elem]);
+                }
+
+                continue;
+            }
+
+            size_t curr = index;
+            calls.pop_back();
+
+            if (!calls.empty())
+            {
+                size_t caller = calls.back().first;
+                ll_vec[caller] = std::min(ll_vec[caller], ll_vec[curr]);
+            }
+
+            if (ip_vec[curr] == ll_vec[curr])
+            {
+                result.emplace_back();
+                while (!st.empty() && st.top() != curr)
+                {
+                    result.back().push_back(st.top());
+                    visited[st.top()] = false;
+                    st.pop();
+                }
+
+                if (!st.empty())
+                {
+                    result.back().push_back(st.top());
+                    visited[st.top()] = false;
+                    st.pop();
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+template <typename VertexId, typename Weight>
+std::vector<long long> MappedGraph<VertexId, Weight>::SSSP(const size_t& source) const
+{
+    std::vector<size_t> topo_sort = topoKahn();
+
+    if (topo_sort.empty())
+    {
+        return std::vector<long long>();
+    }
+
+    std::vector<long long> result(vertexCount(), std::numeric_limits<long long>::max());
+    result[source] = 0;
+
+    for (auto& val : topo_sort)
+    {
+        if (result[val] != std::numeric_limits<long long>::max())
+        {
+            for (size_t pos = offsets[val]; pos < offsets[val + 1]; ++pos)
+            {
+                result[targets[pos]] = std::min(result[targets[pos]], result[val] + weight(pos));
+            }
+        }
+    }
+
+    return result;
+}
+
+template <typename VertexId, typename Weight>
+std::vector<std::pair<std::vector<size_t>, long long>> MappedGraph<VertexId, Weight>::dijkstra(const size_t& source) const
+{
+    std::vector<long long> distances(vertexCount(), std::numeric_limits<long long>::max());
+    std::vector<size_t> parents(vertexCount(), npos);
+    distances[source] = 0;
+
+    // every vertex is queued at most once, a shorter distance lowers its key in place
+    IndexedHeap<long long> heap(vertexCount());
+    heap.push(source, 0);
+
+    std::vector<bool> visited(vertexCount(), false);
+
+    while (!heap.empty())
+    {
+        size_t curr = heap.top().second;
+        heap.pop();
+
+        visited[curr] = true;
+
+        for (size_t pos = offsets[curr]; pos < offsets[curr + 1]; ++pos)
+        {
+            size_t elem = targets[pos];
+            if (!visited[elem] && distances[curr] + weight(pos) < distances[elem])
+            {
+                // only the parent is recorded, the paths are built once at the end
+                distances[elem] = distances[curr] + weight(pos);
+                parents[elem] = curr;
+
+                heap.push(elem, distances[elem]);
+            }
+        }
+    }
+
+    std::vector<std::pair<std::vector<size_t>, long long>> result(vertexCount(), {std::vector<size_t>(), std::numeric_limits<long long>::max()});
+    for (size_t i = 0; i < vertexCount(); ++i)
+    {
+        if (distances[i] != std::numeric_limits<long long>::max())
+        {
+            result[i] = {constructPath(parents, i), distances[i]};
+        }
+    }
+
+    return result;
+}
\ No newline at end of file
@@ -1,84 +1,10 @@
 #ifndef GRAPH_LIST_H
 #define GRAPH_LIST_H
 
-#include <iostream>
-#include <vector>
-#include <stack>
-#include <queue>
-#include <utility>
-#include <algorithm>
+#include "../Unified/runtime_graph.h"
 
-class Graph
-{
-private:
-    void printDfsRecH(const size_t& index2, std::vector<bool>& visited) const;
-    
-    std::vector<size_t> constructPath(const std::vector<size_t>& visited, size_t& dest) const;
-
-    void levelRec(const size_t& level, std::vector<bool>& visisted, std::vector<size_t>& result) const;
-
-    void allPathesRec(const size_t& source, const size_t& dest, std::vector<std::vector<size_t>>& result, 
-                        std::vector<bool>& visited, std::vector<size_t>& path) const;
-
-    bool hasCycleRec(const size_t& index, const size_t& parent,
-                     std::vector<bool>& visited, std::vector<bool>& tmp) const;
-    
-    bool topoRec(const size_t& i, std::vector<size_t>& result,
-                std::vector<bool>& visited, std::vector<bool>& path) const;
-
-    void kosarajuRec(const size_t& index, std::vector<bool>& visited, std::stack<size_t>& st) const;
-    void kosarajuRec(const size_t& index, std::vector<bool>& visited, std::stack<size_t>& st,
-                    std::vector<std::vector<size_t>>& result) const;
-
-    void tarjanRec(const size_t& index, std::vector<std::vector<size_t>>& result, std::vector<bool>& visited,
-                std::stack<size_t>& st, size_t& ip, std::vector<long long>& ip_vec, std::vector<long long>& ll_vec) const;
-
-public:
-    Graph() = default;
-    Graph(const std::vector<std::pair<size_t, size_t>>& edges, bool mode = 0);
-    Graph(const Graph& gr) = default;
-    Graph(Graph&& gr) = default;
-
-    ~Graph() = default;
-
-    void addEdge(const size_t& index1, const size_t& index2);
-    void addVertex(const size_t& add_size = 1);
-
-    void removeEdge(const size_t& index, const size_t& index2);
-    void removeVertex(const size_t& vertex);
-
-    void clear();
-
-    void transpose();
-
-    size_t vertexCount() const;
-    size_t edgeCount() const;
-
-    void printDfsIterative(const size_t& index) const;
-    void printDfsRecursive(const size_t& index) const;
-
-    void printBfs(const size_t& index) const;
-
-    std::vector<size_t> printLevelDfs(const size_t& index, const size_t& level) const; // have some questions
-    std::vector<size_t> printLevelBfs(const size_t& index, size_t level) const;
-
-    std::vector<size_t> getShortPath(const size_t& source, size_t dest) const;
-
-    std::vector<std::vector<size_t>> allPathes(const size_t& source, const size_t& dest) const;
-
-    bool hasCycle() const;
-
-    std::vector<size_t> topoDfs() const;
-    std::vector<size_t> topoKahn() const;
-
-    std::vector<std::vector<size_t>> kosaraju() const;
-    std::vector<std::vector<size_t>> tarjan() const;
-
-private:
-    std::vector<std::vector<bool>> vec;
-    bool mode;
-};
-
-#include "graph_matrix.hpp"
+// unweighted bit matrix, one bit per cell and 64 cells per word, directed or not by the constructor's mode,
+// the algorithms live in BasicGraph (Unified/graph_unified.h)
+typedef RuntimeGraph<BitMatrixStorage<size_t>, false> Graph;
 
 #endif
\ No newline at end of file
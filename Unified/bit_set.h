@@ -0,0 +1,32 @@
+#ifndef BIT_SET_H
+#define BIT_SET_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+
+// Fixed-size set of ids packed into 64-bit words. The traversals keep their visited marks in one, so
+// the bit matrix storage can mask a whole row word against it and skip 64 seen neighbours at once.
+class BitSet
+{
+public:
+    BitSet(const size_t& size = 0);
+
+    bool test(const size_t& index) const;
+    void set(const size_t& index);
+    void reset(const size_t& index);
+
+    // resizes to size ids, all of them cleared
+    void assign(const size_t& size);
+
+    size_t words() const;
+    uint64_t word(const size_t& index) const;
+
+private:
+    std::vector<uint64_t> bits;
+};
+
+#include "bit_set.hpp"
+
+#endif
\ No newline at end of file
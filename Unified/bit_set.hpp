@@ -0,0 +1,33 @@
+inline BitSet::BitSet(const size_t& size) : bits((size + 63) >> 6, 0)
+{
+}
+
+inline bool BitSet::test(const size_t& index) const
+{
+    return bits[index >> 6] >> (index & 63) & 1;
+}
+
+inline void BitSet::set(const size_t& index)
+{
+    bits[index >> 6] |= uint64_t(1) << (index & 63);
+}
+
+inline void BitSet::reset(const size_t& index)
+{
+    bits[index >> 6] &= ~(uint64_t(1) << (index & 63));
+}
+
+inline void BitSet::assign(const size_t& size)
+{
+    bits.assign((size + 63) >> 6, 0);
+}
+
+inline size_t BitSet::words() const
+{
+    return bits.size();
+}
+
+inline uint64_t BitSet::word(const size_t& index) const
+{
+    return bits[index];
+}
\ No newline at end of file
@@ -0,0 +1,290 @@
+#ifndef GRAPH_UNIFIED_H
+#define GRAPH_UNIFIED_H
+
+#include <iostream>
+#include <vector>
+#include <stack>
+#include <queue>
+#include <utility>
+#include <tuple>
+#include <algorithm>
+#include <limits>
+#include <thread>
+#include <atomic>
+#include <barrier>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "storage.h"
+#include "hierarchy.h"
+#include "../Mapped/graph_format.h"
+#include "../Listed_Weighted/indexed_heap.h"
+#include "../Listed_Weighted/radix_heap.h"
+#include "../Listed_Weighted/bucket_queue.h"
+
+// shortest-path tree: distances[i] is max() and parents[i] is -1 for unreachable vertices, min() and -1
+// for vertices behind a negative cycle (bellmanFordTree), the source also has no parent
+struct PathTree
+{
+    std::vector<long long> distances;
+    std::vector<size_t> parents;
+};
+
+// outcome of a point-to-point search: the path (empty when target is unreachable), its cost and
+// how many vertices were taken off the queue to find it
+struct SearchResult
+{
+    std::vector<size_t> path;
+    long long distance;
+    size_t settled;
+};
+
+// queue behind dijkstra: Heap takes any non-negative weights, Radix and Buckets need integer weights and
+// skip comparisons, Buckets keeps max weight + 1 buckets so it suits small maximum weights (above 2^16 it
+// runs as Radix). Both monotone queues hand over to Heap while the graph may hold a negative weight
+enum class QueueType
+{
+    Heap,
+    Radix,
+    Buckets
+};
+
+// Single implementation of the graph algorithms for every representation.
+// Storage selects the adjacency layout (ListStorage, BitMatrixStorage, MatrixStorage, HybridStorage, CSRStorage),
+// Weighted and Directed are compile-time switches, so addEdge and the traversals carry no runtime `mode` checks.
+// Unweighted graphs give every edge weight 1. The legacy Graph classes are RuntimeGraph aliases over this template.
+template <typename Storage, bool Weighted = true, bool Directed = false>
+class BasicGraph
+{
+public:
+    typedef typename Storage::vertex_type vertex_type;
+    typedef typename Storage::weight_type weight_type;
+
+    typedef ::PathTree PathTree;
+    typedef ::SearchResult SearchResult;
+    typedef ::QueueType QueueType;
+
+    // read-only snapshot with the same algorithms, see freeze
+    typedef BasicGraph<CSRStorage<vertex_type, weight_type>, Weighted, Directed> CSR;
+    typedef ContractionHierarchy<vertex_type> Hierarchy;
+
+    static constexpr bool weighted = Weighted;
+    static constexpr bool directed = Directed;
+
+private:
+    template <typename, bool, bool>
+    friend class BasicGraph;
+
+    static constexpr size_t npos = static_cast<size_t>(-1); // no parent, no vertex
+    static constexpr size_t max_buckets = static_cast<size_t>(1) << 16; // Buckets runs as Radix past this
+
+    class Union
+    {
+        public:
+            Union(const size_t& size);
+
+            size_t findParent(const size_t& u);
+            bool unionFind(const size_t& u, const size_t& v);
+
+        private:
+            std::vector<vertex_type> parents;
+            std::vector<vertex_type> sizes;
+    };
+
+    void printDfsRecH(const size_t& index, BitSet& visited) const;
+
+    std::vector<size_t> constructPath(const std::vector<size_t>& visited, size_t& dest) const;
+
+    void levelRec(const size_t& level, BitSet& visited, std::vector<size_t>& result) const;
+
+    void allPathesRec(const size_t& source, const size_t& dest, std::vector<std::vector<size_t>>& result,
+                    std::vector<bool>& visited, std::vector<size_t>& path, long long w) const;
+
+    bool hasCycleRec(const size_t& index, const size_t& parent,
+                    std::vector<bool>& visited, std::vector<bool>& path) const;
+
+    bool topoRec(const size_t& i, std::vector<size_t>& result,
+                std::vector<bool>& visited, std::vector<bool>& path) const;
+
+    // in-edges of every vertex: storage itself when undirected, rev while incoming is tracked, nullptr when
+    // the storage scans its columns cheaply, otherwise a transposed copy made in copy
+    const Storage* reversed(Storage& copy) const;
+
+    // f(source, weight) for every edge into index, reversed as returned by reversed()
+    template <typename F>
+    void forEachIn(const Storage* reversed, const size_t& index, F&& f) const;
+    template <typename F>
+    void forEachInUnvisited(const Storage* reversed, const size_t& index, const BitSet& visited, F&& f) const;
+
+    void restoreVertex(const size_t& vertex);
+
+    // entries[offsets[i]..offsets[i + 1]) are the edges of vertex i in input order, encoded as edge index * 2,
+    // plus 1 when the edge was bucketed under its second endpoint (undirected graphs)
+    template <typename Edge>
+    static void bucketEdges(const std::vector<Edge>& edges, const size_t& threads,
+                            std::vector<size_t>& offsets, std::vector<size_t>& entries);
+    template <typename Edge>
+    static size_t entryTarget(const Edge& edge, const size_t& entry);
+    template <typename Edge>
+    void build(const std::vector<Edge>& edges, const size_t& threads);
+
+    template <typename Queue>
+    PathTree dijkstraMonotone(const size_t& source, Queue& queue) const;
+
+    // bellman-ford from every vertex in sources at once (distance 0 each), as if from one virtual source
+    PathTree bellmanFordFrom(const std::vector<size_t>& sources, std::vector<size_t>& cycle) const;
+
+public:
+    BasicGraph() = default;
+    // bulk build: edges are bucketed by source over threads and every row is filled once with exactly
+    // reserved space, a repeated edge keeps the weight it was given last, as with addEdge
+    BasicGraph(const std::vector<std::tuple<size_t, size_t, size_t>>& edges, size_t threads = 1);
+    BasicGraph(const std::vector<std::pair<size_t, size_t>>& edges, size_t threads = 1);
+    BasicGraph(const BasicGraph& gr) = default;
+    BasicGraph(BasicGraph&& gr) = default;
+
+    ~BasicGraph() = default;
+
+    BasicGraph& operator=(const BasicGraph& gr) = default;
+    BasicGraph& operator=(BasicGraph&& gr) = default;
+
+    void addEdge(const size_t& index1, const size_t& index2, const size_t& w = 1) requires EditableStorage<Storage>;
+    void addVertex(const size_t& add_size = 1) requires EditableStorage<Storage>;
+
+    void removeEdge(const size_t& index1, const size_t& index2) requires EditableStorage<Storage>;
+
+    // removed vertices are only tombstoned, their ids stay valid (and empty) until insertVertex reuses
+    // them or compact renumbers the graph, compact returns old id -> new id with -1 for removed ones.
+    // matrix storages (matrix_layout) drop the vertex at once and the higher ids move down by one
+    void removeVertex(const size_t& vertex) requires EditableStorage<Storage>;
+    size_t insertVertex() requires EditableStorage<Storage>;
+    std::vector<size_t> compact() requires EditableStorage<Storage>;
+
+    void clear();
+
+    void transpose();
+
+    // keep in-edges alongside out-edges so kosaraju, inDegree, topoKahn and predecessors don't
+    // have to copy or rescan the graph, costs one more storage (directed graphs only)
+    void trackIncoming(bool enable = true);
+    bool tracksIncoming() const;
+
+    bool isDirected() const;
+
+    size_t vertexCount() const;
+    size_t edgeCount() const;
+
+    // ids of the vertices that aren't removed, ascending
+    std::vector<size_t> liveVertices() const;
+
+    size_t inDegree(const size_t& index) const;
+    std::vector<size_t> predecessors(const size_t& index) const;
+
+    void printDfsIterative(const size_t& index) const;
+    void printDfsRecursive(const size_t& index) const;
+
+    void printBfs(const size_t& index) const;
+
+    // a line per vertex with its neighbours (and weights), matrix storages print their rows of weights
+    void printGraph() const;
+    std::vector<size_t> printLevelDfs(const size_t& index, const size_t& level) const;
+    std::vector<size_t> printLevelBfs(const size_t& index, size_t level) const;
+
+    std::vector<size_t> getShortPath(const size_t& source, size_t dest) const;
+
+    std::vector<std::vector<size_t>> allPathes(const size_t& source, const size_t& dest) const;
+
+    bool hasCycle() const;
+
+    std::vector<size_t> topoDfs() const;
+    std::vector<size_t> topoKahn() const;
+
+    // both walk an explicit stack, so deep graphs don't exhaust the call stack
+    std::vector<std::vector<size_t>> kosaraju() const;
+    std::vector<std::vector<size_t>> tarjan() const;
+
+    std::vector<long long> SSSP(const size_t& source) const;
+    std::vector<std::pair<std::vector<size_t>, long long>> dijkstra(const size_t& source, QueueType queue = QueueType::Heap) const;
+    PathTree dijkstraTree(const size_t& source, QueueType queue = QueueType::Heap) const;
+    // dijkstra over the in-edges: distances[v] is d(v, target) and parents[v] the next vertex towards target.
+    // a directed graph that doesn't track incoming edges (and can't scan its columns) is transposed per call
+    PathTree dijkstraTreeTo(const size_t& target) const;
+    std::vector<size_t> getPath(const PathTree& tree, size_t dest) const;
+
+    // point-to-point query: forward and backward dijkstra meet in the middle, so only vertices closer than about
+    // half the answer get settled, returns the path and its cost ({} and max() when target is unreachable).
+    // the backward side walks in-edges, directed list graphs that don't trackIncoming run a one-sided search instead
+    std::pair<std::vector<size_t>, long long> shortestPath(const size_t& source, const size_t& target) const;
+
+    // goal-directed dijkstra, heuristic(v) must not overestimate the distance from v to target (fractions are
+    // truncated), the search stops as soon as target is settled
+    template <typename Heuristic>
+    SearchResult astar(const size_t& source, const size_t& target, Heuristic heuristic) const;
+
+    std::vector<std::pair<std::vector<size_t>, long long>> bellmanFord(const size_t& source) const;
+
+    // queue-based bellman-ford that only rescans vertices whose distance dropped, negative weights are fine.
+    // cycle gets the vertices of a negative cycle reachable from source in edge order (the last one leads back
+    // to the first), or stays empty, everything such a cycle reaches is min() in the tree
+    PathTree bellmanFordTree(const size_t& source, std::vector<size_t>& cycle) const;
+
+    // edge-centric rounds over flat in-edge arrays spread across threads, the distances of bellmanFordTree
+    // (min() behind negative cycles), stops after the first round that changes nothing
+    std::vector<long long> bellmanFordParallel(const size_t& source, size_t threads = std::thread::hardware_concurrency()) const;
+
+    // all-pairs distances for sparse graphs with negative weights: one bellman-ford pass finds potentials that
+    // make every weight non-negative, then the sources run dijkstra spread over threads. callback(source, row)
+    // gets the distances from source (max() for unreachable) and is called from the worker threads, for different
+    // sources at the same time, row is only valid during the call. false when there is a negative cycle
+    template <typename Callback>
+    bool johnson(Callback callback, size_t threads = std::thread::hardware_concurrency()) const;
+
+    // the full V x V matrix, row-major, either in memory or written through a shared mapping of the file at path
+    // (raw native long longs, nothing else), so the matrix never has to fit in memory at once
+    bool johnsonMatrix(std::vector<long long>& distances, size_t threads = std::thread::hardware_concurrency()) const;
+    bool johnsonMatrix(const std::string& path, size_t threads = std::thread::hardware_concurrency()) const;
+
+    // parallel SSSP distances (same as dijkstra's) for non-negative weights, delta is the bucket width,
+    // 0 picks the average edge weight
+    std::vector<long long> deltaStepping(const size_t& source, long long delta = 0,
+                                        size_t threads = std::thread::hardware_concurrency()) const;
+
+    BasicGraph Prim() const requires EditableStorage<Storage>;
+    BasicGraph Kruskal() const requires EditableStorage<Storage>;
+
+    // immutable CSR copy: rows sorted by target and scanned sequentially, the traversals and shortest paths
+    // run faster on it, edits need the mutable graph
+    CSR freeze() const;
+
+    // node ordering by edge difference with lazy updates, witness searches are capped so a few
+    // redundant shortcuts may be kept, they never change a distance
+    Hierarchy contract() const;
+
+    // read-only: edits go through the members above so the reverse storage, tombstones and counts stay in step
+    const Storage& getStorage() const;
+
+    // HybridStorage density thresholds, applied to the reverse storage as well
+    void setThresholds(const double& to_matrix, const double& to_list)
+        requires requires (Storage& s, const double& d) { s.setThresholds(d, d); };
+
+    bool save(const std::string& path) const;
+
+private:
+    Storage storage;
+    Storage rev; // rev holds the transposed graph while incoming is set
+    std::vector<bool> removed;
+    std::vector<size_t> free_ids;
+    size_t removed_count = 0;
+    bool incoming = false;
+
+    // bounds on every weight added since the last clear, removals leave them loose so they never need a scan
+    weight_type lightest = 0;
+    weight_type heaviest = 0;
+};
+
+#include "graph_unified.hpp"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,2630 @@
+template <typename Storage, bool Weighted, bool Directed>
+BasicGraph<Storage, Weighted, Directed>::BasicGraph(const std::vector<std::tuple<size_t, size_t, size_t>>& edges, size_t threads)
+{
+    build(edges, threads);
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+BasicGraph<Storage, Weighted, Directed>::BasicGraph(const std::vector<std::pair<size_t, size_t>>& edges, size_t threads)
+{
+    build(edges, threads);
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+template <typename Edge>
+void BasicGraph<Storage, Weighted, Directed>::bucketEdges(const std::vector<Edge>& edges, const size_t& threads,
+                        std::vector<size_t>& offsets, std::vector<size_t>& entries)
+{
+    std::atomic<size_t> max = 0;
+    parallelFor(edges.size(), threads, [&](const size_t& first, const size_t& last)
+    {
+        size_t local = 0;
+        for (size_t k = first; k < last; ++k)
+        {
+            local = std::max({local, std::get<0>(edges[k]), std::get<1>(edges[k])});
+        }
+
+        size_t seen = max.load();
+        while (local > seen && !max.compare_exchange_weak(seen, local));
+    });
+
+    // the atomic degree counters become the scatter cursors once the offsets are known
+    std::vector<std::atomic<size_t>> cursors(max + 1);
+    parallelFor(edges.size(), threads, [&](const size_t& first, const size_t& last)
+    {
+        for (size_t k = first; k < last; ++k)
+        {
+            cursors[std::get<0>(edges[k])].fetch_add(1, std::memory_order_relaxed);
+
+            if constexpr (!Directed)
+            {
+                cursors[std::get<1>(edges[k])].fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    });
+
+    offsets.assign(cursors.size() + 1, 0);
+    parallelFor(cursors.size(), threads, [&](const size_t& first, const size_t& last)
+    {
+        for (size_t i = first; i < last; ++i)
+        {
+            offsets[i + 1] = cursors[i].load(std::memory_order_relaxed);
+        }
+    });
+
+    prefixSum(offsets, threads);
+
+    parallelFor(cursors.size(), threads, [&](const size_t& first, const size_t& last)
+    {
+        for (size_t i = first; i < last; ++i)
+        {
+            cursors[i].store(offsets[i], std::memory_order_relaxed);
+        }
+    });
+
+    entries.resize(offsets.back());
+    parallelFor(edges.size(), threads, [&](const size_t& first, const size_t& last)
+    {
+        for (size_t k = first; k < last; ++k)
+        {
+            entries[cursors[std::get<0>(edges[k])].fetch_add(1, std::memory_order_relaxed)] = k << 1;
+
+            if constexpr (!Directed)
+            {
+                entries[cursors[std::get<1>(edges[k])].fetch_add(1, std::memory_order_relaxed)] = k << 1 | 1;
+            }
+        }
+    });
+
+    // threads interleave in the scatter, sorting the codes puts every row back in input order
+    parallelRows(offsets, threads, [&](const size_t& i)
+    {
+        std::sort(entries.begin() + offsets[i], entries.begin() + offsets[i + 1]);
+    });
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+template <typename Edge>
+size_t BasicGraph<Storage, Weighted, Directed>::entryTarget(const Edge& edge, const size_t& entry)
+{
+    return entry & 1 ? std::get<0>(edge) : std::get<1>(edge);
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+template <typename Edge>
+void BasicGraph<Storage, Weighted, Directed>::build(const std::vector<Edge>& edges, const size_t& threads)
+{
+    if (edges.empty())
+    {
+        return;
+    }
+
+    std::vector<size_t> rows;
+    std::vector<size_t> entries;
+    bucketEdges(edges, threads, rows, entries);
+
+    // stable sorting by target keeps duplicates in input order, the last of each run wins as with addEdge
+    std::vector<size_t> offsets(rows.size(), 0);
+    parallelRows(rows, threads, [&](const size_t& i)
+    {
+        auto begin = entries.begin() + rows[i];
+        auto end = entries.begin() + rows[i + 1];
+
+        std::stable_sort(begin, end, [&](const size_t& entry1, const size_t& entry2)
+        {
+            return entryTarget(edges[entry1 >> 1], entry1) < entryTarget(edges[entry2 >> 1], entry2);
+        });
+
+        size_t length = 0;
+        for (auto it = begin; it != end; ++it)
+        {
+            if (it + 1 == end || entryTarget(edges[*it >> 1], *it) != entryTarget(edges[it[1] >> 1], it[1]))
+            {
+                begin[length++] = *it;
+            }
+        }
+
+        offsets[i + 1] = length;
+    });
+
+    prefixSum(offsets, threads);
+
+    // every storage fills its rows in one pass, spread over threads where rows don't share memory
+    storage.assign(offsets, threads, [&](const size_t& i, auto&& f)
+    {
+        for (size_t j = 0; j < offsets[i + 1] - offsets[i]; ++j)
+        {
+            size_t entry = entries[rows[i] + j];
+
+            weight_type w = 1;
+            if constexpr (Weighted && std::tuple_size_v<Edge> == 3)
+            {
+                w = static_cast<weight_type>(std::get<2>(edges[entry >> 1]));
+            }
+
+            f(entryTarget(edges[entry >> 1], entry), w);
+        }
+    });
+
+    for (auto& edge : edges)
+    {
+        weight_type w = 1;
+        if constexpr (Weighted && std::tuple_size_v<Edge> == 3)
+        {
+            w = static_cast<weight_type>(std::get<2>(edge));
+        }
+
+        lightest = std::min(lightest, w);
+        heaviest = std::max(heaviest, w);
+    }
+
+    removed.assign(storage.size(), false);
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+void BasicGraph<Storage, Weighted, Directed>::addEdge(const size_t& index1, const size_t& index2, const size_t& w) requires EditableStorage<Storage>
+{
+    size_t max = std::max(index1, index2);
+    if (max >= storage.size())
+    {
+        addVertex(max - storage.size() + 1);
+    }
+
+    if (removed_count)
+    {
+        restoreVertex(index1);
+        restoreVertex(index2);
+    }
+
+    weight_type weight = Weighted ? static_cast<weight_type>(w) : 1;
+
+    lightest = std::min(lightest, weight);
+    heaviest = std::max(heaviest, weight);
+
+    storage.set(index1, index2, weight);
+
+    if (incoming)
+    {
+        rev.set(index2, index1, weight);
+    }
+
+    if constexpr (!Directed)
+    {
+        storage.set(index2, index1, weight);
+    }
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+void BasicGraph<Storage, Weighted, Directed>::addVertex(const size_t& add_size) requires EditableStorage<Storage>
+{
+    storage.resize(storage.size() + add_size);
+    removed.resize(storage.size(), false);
+
+    if (incoming)
+    {
+        rev.resize(storage.size());
+    }
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+void BasicGraph<Storage, Weighted, Directed>::removeEdge(const size_t& index1, const size_t& index2) requires EditableStorage<Storage>
+{
+    if (storage.contains(index1, index2))
+    {
+        storage.erase(index1, index2);
+
+        if (incoming)
+        {
+            rev.erase(index2, index1);
+        }
+
+        if constexpr (!Directed)
+        {
+            storage.erase(index2, index1);
+        }
+    }
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+void BasicGraph<Storage, Weighted, Directed>::removeVertex(const size_t& vertex) requires EditableStorage<Storage>
+{
+    if (vertex >= storage.size() || removed[vertex])
+    {
+        return;
+    }
+
+    // the matrix graphs drop the vertex's row and column right away and every higher id moves down by one,
+    // so they never hold tombstones
+    if constexpr (Storage::matrix_layout)
+    {
+        std::vector<size_t> mapping(storage.size());
+        for (size_t i = 0; i < storage.size(); ++i)
+        {
+            mapping[i] = i < vertex ? i : i - 1;
+        }
+
+        mapping[vertex] = npos;
+
+        size_t count = storage.size() - 1;
+        storage.renumber(mapping, count);
+
+        if (incoming)
+        {
+            rev.renumber(mapping, count);
+        }
+
+        removed.assign(count, false);
+
+        return;
+    }
+
+    // neighbours are collected before erasing, a HybridStorage may switch layouts on any erase
+    std::vector<size_t> neighbours;
+    auto collect = [&](const size_t& elem, const weight_type&)
+    {
+        if (elem != vertex)
+        {
+            neighbours.push_back(elem);
+        }
+    };
+
+    if constexpr (!Directed)
+    {
+        storage.forEach(vertex, collect);
+        for (auto& elem : neighbours)
+        {
+            storage.erase(elem, vertex);
+        }
+    }
+    else if (incoming)
+    {
+        rev.forEach(vertex, collect);
+        for (auto& elem : neighbours)
+        {
+            storage.erase(elem, vertex);
+        }
+
+        neighbours.clear();
+        storage.forEach(vertex, collect);
+        for (auto& elem : neighbours)
+        {
+            rev.erase(elem, vertex);
+        }
+
+        rev.clearRow(vertex);
+    }
+    else
+    {
+        // without in-edges every row has to be checked for edges into vertex
+        for (size_t i = 0; i < storage.size(); ++i)
+        {
+            storage.erase(i, vertex);
+        }
+    }
+
+    storage.clearRow(vertex);
+
+    removed[vertex] = true;
+    ++removed_count;
+    free_ids.push_back(vertex);
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+void BasicGraph<Storage, Weighted, Directed>::restoreVertex(const size_t& vertex)
+{
+    if (removed[vertex])
+    {
+        removed[vertex] = false;
+        --removed_count;
+    }
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+size_t BasicGraph<Storage, Weighted, Directed>::insertVertex() requires EditableStorage<Storage>
+{
+    // ids restored by addEdge are still in the free list, skip them
+    while (!free_ids.empty())
+    {
+        size_t vertex = free_ids.back();
+        free_ids.pop_back();
+
+        if (removed[vertex])
+        {
+            restoreVertex(vertex);
+            return vertex;
+        }
+    }
+
+    addVertex();
+
+    return storage.size() - 1;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+std::vector<size_t> BasicGraph<Storage, Weighted, Directed>::compact() requires EditableStorage<Storage>
+{
+    std::vector<size_t> mapping(storage.size(), npos);
+
+    size_t count = 0;
+    for (size_t i = 0; i < storage.size(); ++i)
+    {
+        if (!removed[i])
+        {
+            mapping[i] = count++;
+        }
+    }
+
+    if (count != storage.size())
+    {
+        storage.renumber(mapping, count);
+
+        if (incoming)
+        {
+            rev.renumber(mapping, count);
+        }
+    }
+
+    removed.assign(count, false);
+    free_ids.clear();
+    removed_count = 0;
+
+    return mapping;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+void BasicGraph<Storage, Weighted, Directed>::clear()
+{
+    storage.clear();
+    rev.clear();
+    removed.clear();
+    free_ids.clear();
+    removed_count = 0;
+    lightest = 0;
+    heaviest = 0;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+void BasicGraph<Storage, Weighted, Directed>::transpose()
+{
+    if constexpr (Directed)
+    {
+        if (incoming)
+        {
+            std::swap(storage, rev);
+        }
+        else
+        {
+            storage.transpose();
+        }
+    }
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+void BasicGraph<Storage, Weighted, Directed>::trackIncoming(bool enable)
+{
+    incoming = enable && Directed;
+
+    rev = Storage();
+    if (incoming)
+    {
+        rev = storage;
+        rev.transpose();
+    }
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+bool BasicGraph<Storage, Weighted, Directed>::tracksIncoming() const
+{
+    return incoming;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+bool BasicGraph<Storage, Weighted, Directed>::isDirected() const
+{
+    return Directed;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+size_t BasicGraph<Storage, Weighted, Directed>::vertexCount() const
+{
+    return storage.size() - removed_count;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+size_t BasicGraph<Storage, Weighted, Directed>::edgeCount() const
+{
+    return storage.edgeCount();
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+std::vector<size_t> BasicGraph<Storage, Weighted, Directed>::liveVertices() const
+{
+    std::vector<size_t> result;
+    result.reserve(vertexCount());
+
+    for (size_t i = 0; i < storage.size(); ++i)
+    {
+        if (!removed[i])
+        {
+            result.push_back(i);
+        }
+    }
+
+    return result;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+const Storage* BasicGraph<Storage, Weighted, Directed>::reversed(Storage& copy) const
+{
+    // an undirected graph is its own transpose, a tracked one already has it in rev
+    if (!Directed)
+    {
+        return &storage;
+    }
+
+    if (incoming)
+    {
+        return &rev;
+    }
+
+    if (storage.scansColumns())
+    {
+        return nullptr;
+    }
+
+    copy = storage;
+    copy.transpose();
+
+    return &copy;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+template <typename F>
+void BasicGraph<Storage, Weighted, Directed>::forEachIn(const Storage* reversed, const size_t& index, F&& f) const
+{
+    if (reversed)
+    {
+        reversed->forEach(index, f);
+    }
+    else
+    {
+        storage.forEachIn(index, f);
+    }
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+template <typename F>
+void BasicGraph<Storage, Weighted, Directed>::forEachInUnvisited(const Storage* reversed, const size_t& index, const BitSet& visited, F&& f) const
+{
+    if (reversed)
+    {
+        reversed->forEachUnvisited(index, visited, f);
+    }
+    else
+    {
+        storage.forEachIn(index, [&](const size_t& elem, const weight_type& w)
+        {
+            if (!visited.test(elem))
+            {
+                f(elem, w);
+            }
+        });
+    }
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+size_t BasicGraph<Storage, Weighted, Directed>::inDegree(const size_t& index) const
+{
+    if (incoming)
+    {
+        return rev.degree(index);
+    }
+
+    if constexpr (!Directed)
+    {
+        return storage.degree(index);
+    }
+
+    size_t degree = 0;
+    storage.forEachIn(index, [&](const size_t&, const weight_type&)
+    {
+        ++degree;
+    });
+
+    return degree;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+std::vector<size_t> BasicGraph<Storage, Weighted, Directed>::predecessors(const size_t& index) const
+{
+    std::vector<size_t> result;
+
+    // a single column is scanned in place instead of reversing the whole graph
+    forEachIn(!Directed ? &storage : (incoming ? &rev : nullptr), index, [&](const size_t& elem, const weight_type&)
+    {
+        result.push_back(elem);
+    });
+
+    return result;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+void BasicGraph<Storage, Weighted, Directed>::printGraph() const
+{
+    for (size_t i = 0; i < storage.size(); ++i)
+    {
+        if (removed[i])
+        {
+            continue;
+        }
+
+        std::cout << i << " - ";
+        if constexpr (Storage::matrix_layout)
+        {
+            for (size_t j = 0; j < storage.size(); ++j)
+            {
+                std::cout << storage.weight(i, j) << ' ';
+            }
+        }
+        else
+        {
+            storage.forEach(i, [](const size_t& elem, const weight_type& w)
+            {
+                if constexpr (Weighted)
+                {
+                    std::cout << elem << ' ' << w << ':';
+                }
+                else
+                {
+                    std::cout << elem << ' ';
+                }
+            });
+        }
+        std::cout << std::endl;
+    }
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+void BasicGraph<Storage, Weighted, Directed>::printDfsIterative(const size_t& index) const
+{
+    std::stack<size_t> indexes;
+    indexes.push(index);
+
+    BitSet visited(storage.size());
+    visited.set(index);
+
+    while (!indexes.empty())
+    {
+        size_t curr = indexes.top();
+        indexes.pop();
+
+        std::cout << curr << ' ';
+
+        storage.forEachUnvisited(curr, visited, [&](const size_t& elem, const weight_type&)
+        {
+            visited.set(elem);
+            indexes.push(elem);
+        });
+    }
+
+    std::cout << std::endl;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+void BasicGraph<Storage, Weighted, Directed>::printDfsRecH(const size_t& index, BitSet& visited) const
+{
+    visited.set(index);
+
+    std::cout << index << ' ';
+
+    storage.forEachUnvisited(index, visited, [&](const size_t& elem, const weight_type&)
+    {
+        printDfsRecH(elem, visited);
+    });
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+void BasicGraph<Storage, Weighted, Directed>::printDfsRecursive(const size_t& index) const
+{
+    BitSet visited(storage.size());
+    printDfsRecH(index, visited);
+
+    std::cout << std::endl;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+void BasicGraph<Storage, Weighted, Directed>::printBfs(const size_t& index) const
+{
+    std::queue<size_t> indexes;
+    indexes.push(index);
+
+    BitSet visited(storage.size());
+    visited.set(index);
+
+    size_t size = 1;
+    size_t new_size = 0;
+    while (!indexes.empty())
+    {
+        size_t curr = indexes.front();
+        indexes.pop();
+
+        std::cout << curr << ' ';
+
+        storage.forEachUnvisited(curr, visited, [&](const size_t& elem, const weight_type&)
+        {
+            ++new_size;
+            visited.set(elem);
+            indexes.push(elem);
+        });
+
+        --size;
+        if (!size)
+        {
+            size = new_size;
+            new_size = 0;
+            std::cout << std::endl;
+        }
+    }
+
+    std::cout << std::endl;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+std::vector<size_t> BasicGraph<Storage, Weighted, Directed>::constructPath(const std::vector<size_t>& visited, size_t& dest) const
+{
+    std::vector<size_t> result;
+    while (dest != npos)
+    {
+        result.push_back(dest);
+        dest = visited[dest];
+    }
+
+    std::reverse(result.begin(), result.end());
+
+    return result;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+std::vector<size_t> BasicGraph<Storage, Weighted, Directed>::getShortPath(const size_t& source, size_t dest) const
+{
+    std::queue<size_t> indexes;
+    indexes.push(source);
+
+    std::vector<size_t> parents(storage.size(), npos);
+    BitSet visited(storage.size());
+    visited.set(source);
+
+    while (!indexes.empty())
+    {
+        size_t curr = indexes.front();
+        indexes.pop();
+
+        if (curr == dest)
+        {
+            return constructPath(parents, dest);
+        }
+
+        storage.forEachUnvisited(curr, visited, [&](const size_t& elem, const weight_type&)
+        {
+            visited.set(elem);
+            parents[elem] = curr;
+            indexes.push(elem);
+        });
+    }
+
+    return std::vector<size_t>();
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+void BasicGraph<Storage, Weighted, Directed>::levelRec(const size_t& level, BitSet& visited, std::vector<size_t>& result) const
+{
+    if (level)
+    {
+        std::vector<size_t> new_level;
+        for (size_t index : result)
+        {
+            storage.forEachUnvisited(index, visited, [&](const size_t& elem, const weight_type&)
+            {
+                new_level.push_back(elem);
+                visited.set(elem);
+            });
+        }
+
+        result = std::move(new_level);
+        levelRec(level - 1, visited, result);
+    }
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+std::vector<size_t> BasicGraph<Storage, Weighted, Directed>::printLevelDfs(const size_t& index, const size_t& level) const
+{
+    BitSet visited(storage.size());
+    visited.set(index);
+
+    std::vector<size_t> result{index};
+
+    levelRec(level, visited, result);
+
+    return result;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+std::vector<size_t> BasicGraph<Storage, Weighted, Directed>::printLevelBfs(const size_t& index, size_t level) const
+{
+    std::queue<size_t> indexes;
+    indexes.push(index);
+
+    BitSet visited(storage.size());
+    visited.set(index);
+
+    size_t size = 1;
+    size_t new_size = 0;
+    while (!indexes.empty() && level)
+    {
+        size_t curr = indexes.front();
+        indexes.pop();
+
+        storage.forEachUnvisited(curr, visited, [&](const size_t& elem, const weight_type&)
+        {
+            ++new_size;
+            visited.set(elem);
+            indexes.push(elem);
+        });
+
+        --size;
+        if (!size)
+        {
+            --level;
+            size = new_size;
+            new_size = 0;
+        }
+    }
+
+    std::vector<size_t> result;
+    while (!indexes.empty())
+    {
+        result.push_back(indexes.front());
+        indexes.pop();
+    }
+
+    return result;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+void BasicGraph<Storage, Weighted, Directed>::allPathesRec(const size_t& source, const size_t& dest, std::vector<std::vector<size_t>>& result,
+                    std::vector<bool>& visited, std::vector<size_t>& path, long long w) const
+{
+    path.push_back(source);
+    visited[source] = true;
+
+    if (source == dest)
+    {
+        result.push_back(path);
+
+        if constexpr (Weighted)
+        {
+            result.back().push_back(w);
+        }
+    }
+
+    else
+    {
+        storage.forEach(source, [&](const size_t& elem, const weight_type& weight)
+        {
+            if (!visited[elem])
+            {
+                allPathesRec(elem, dest, result, visited, path, w + weight);
+            }
+        });
+    }
+
+    visited[source] = false;
+    path.pop_back();
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+std::vector<std::vector<size_t>> BasicGraph<Storage, Weighted, Directed>::allPathes(const size_t& source, const size_t& dest) const
+{
+    std::vector<std::vector<size_t>> result;
+    std::vector<size_t> path;
+    std::vector<bool> visited(storage.size(), false);
+
+    allPathesRec(source, dest, result, visited, path, 0);
+
+    std::sort(result.begin(), result.end(), [](const std::vector<size_t>& val1, const std::vector<size_t>& val2){
+        return val1.size() < val2.size();
+    });
+
+    return result;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+bool BasicGraph<Storage, Weighted, Directed>::hasCycleRec(const size_t& index, const size_t& parent,
+                        std::vector<bool>& visited, std::vector<bool>& path) const
+{
+    path[index] = true;
+    visited[index] = true;
+
+    bool found = false;
+    storage.forEach(index, [&](const size_t& elem, const weight_type&)
+    {
+        if (found)
+        {
+            return;
+        }
+
+        // a directed cycle needs a back edge into the current path, an undirected one any
+        // already visited neighbour except the edge we came through
+        if constexpr (Directed)
+        {
+            found = path[elem] || (!visited[elem] && hasCycleRec(elem, index, visited, path));
+        }
+
+        else
+        {
+            found = (elem != parent && visited[elem]) || (!visited[elem] && hasCycleRec(elem, index, visited, path));
+        }
+    });
+
+    path[index] = false;
+    return found;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+bool BasicGraph<Storage, Weighted, Directed>::hasCycle() const
+{
+    std::vector<bool> visited(storage.size(), false);
+    std::vector<bool> path(storage.size(), false);
+
+    for (size_t i = 0; i < storage.size(); ++i)
+    {
+        if (!visited[i] && hasCycleRec(i, npos, visited, path))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+bool BasicGraph<Storage, Weighted, Directed>::topoRec(const size_t& i, std::vector<size_t>& result, std::vector<bool>& visited, std::vector<bool>& path) const
+{
+    visited[i] = true;
+    path[i] = true;
+
+    bool found = false;
+    storage.forEach(i, [&](const size_t& elem, const weight_type&)
+    {
+        if (!found)
+        {
+            found = visited[elem] ? path[elem] : topoRec(elem, result, visited, path);
+        }
+    });
+
+    if (found)
+    {
+        return true;
+    }
+
+    result.push_back(i);
+
+    path[i] = false;
+
+    return false;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+std::vector<size_t> BasicGraph<Storage, Weighted, Directed>::topoDfs() const
+{
+    std::vector<bool> path(storage.size(), false);
+    std::vector<bool> visited(storage.size(), false);
+    std::vector<size_t> result;
+
+    for (size_t i = 0; i < storage.size(); ++i)
+    {
+        if (!visited[i] && !removed[i] && topoRec(i, result, visited, path))
+        {
+            return std::vector<size_t>();
+        }
+    }
+
+    std::reverse(result.begin(), result.end());
+
+    return result;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+std::vector<size_t> BasicGraph<Storage, Weighted, Directed>::topoKahn() const
+{
+    std::vector<size_t> parent(storage.size(), 0);
+    for (size_t i = 0; i < storage.size(); ++i)
+    {
+        if (incoming)
+        {
+            parent[i] = rev.degree(i);
+            continue;
+        }
+
+        storage.forEach(i, [&](const size_t& elem, const weight_type&)
+        {
+            ++parent[elem];
+        });
+    }
+
+    std::vector<size_t> result;
+    result.reserve(vertexCount());
+
+    for (size_t i = 0; i < storage.size(); ++i)
+    {
+        if (!parent[i] && !removed[i])
+        {
+            result.push_back(i);
+        }
+    }
+
+    // result doubles as the queue: everything after head is still waiting to be expanded
+    for (size_t head = 0; head < result.size(); ++head)
+    {
+        storage.forEach(result[head], [&](const size_t& elem, const weight_type&)
+        {
+            if (!--parent[elem])
+            {
+                result.push_back(elem);
+            }
+        });
+    }
+
+    if (result.size() != vertexCount())
+    {
+        return std::vector<size_t>();
+    }
+
+    return result;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+std::vector<std::vector<size_t>> BasicGraph<Storage, Weighted, Directed>::kosaraju() const
+{
+    BitSet visited(storage.size());
+    std::vector<size_t> order;
+    order.reserve(storage.size());
+
+    // (vertex, expanded): a vertex is marked when it is popped and pushes its unvisited neighbours above its
+    // expanded entry, which comes back up once all of them are finished. the neighbours go on in reverse, so
+    // they are taken in adjacency order and the finishing order is the one of the recursive DFS
+    std::vector<std::pair<size_t, bool>> st;
+    for (size_t i = 0; i < storage.size(); ++i)
+    {
+        if (visited.test(i) || removed[i])
+        {
+            continue;
+        }
+
+        st.emplace_back(i, false);
+
+        while (!st.empty())
+        {
+            auto [curr, expanded] = st.back();
+            st.pop_back();
+
+            if (expanded)
+            {
+                order.push_back(curr);
+                continue;
+            }
+
+            if (visited.test(curr))
+            {
+                continue;
+            }
+
+            visited.set(curr);
+            st.emplace_back(curr, true);
+
+            size_t first = st.size();
+            storage.forEachUnvisited(curr, visited, [&](const size_t& elem, const weight_type&)
+            {
+                st.emplace_back(elem, false);
+            });
+
+            std::reverse(st.begin() + first, st.end());
+        }
+    }
+
+    Storage copy;
+    const Storage* tp = reversed(copy);
+
+    std::vector<std::vector<size_t>> result;
+
+    visited.assign(storage.size());
+
+    std::vector<size_t> dfs;
+    for (auto it = order.rbegin(); it != order.rend(); ++it)
+    {
+        if (visited.test(*it))
+        {
+            continue;
+        }
+
+        result.emplace_back();
+
+        // marked when popped, so every component lists its vertices in the preorder of the recursive DFS
+        dfs.push_back(*it);
+
+        while (!dfs.empty())
+        {
+            size_t curr = dfs.back();
+            dfs.pop_back();
+
+            if (visited.test(curr))
+            {
+                continue;
+            }
+
+            visited.set(curr);
+            result.back().push_back(curr);
+
+            size_t first = dfs.size();
+            forEachInUnvisited(tp, curr, visited, [&](const size_t& elem, const weight_type&)
+            {
+                dfs.push_back(elem);
+            });
+
+            std::reverse(dfs.begin() + first, dfs.end());
+        }
+    }
+
+    return result;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+std::vector<std::vector<size_t>> BasicGraph<Storage, Weighted, Directed>::tarjan() const
+{
+    std::vector<long long> ip_vec(storage.size(), -1);
+    std::vector<long long> ll_vec(storage.size(), -1);
+
+    std::vector<bool> visited(storage.size(), false);
+    std::stack<size_t> st;
+
+    std::vector<std::vector<size_t>> result;
+
+    // (vertex, parent, expanded): the edge parent -> vertex is looked at when its entry is popped, which is when
+    // the recursive version would look at it (the edges go on in reverse to come off in adjacency order), the
+    // expanded entry comes back up once the vertex is finished
+    std::vector<std::tuple<size_t, size_t, bool>> calls;
+
+    size_t ip = 0;
+    for (size_t i = 0; i < storage.size(); ++i)
+    {
+        if (ip_vec[i] != -1 || removed[i])
+        {
+            continue;
+        }
+
+        calls.emplace_back(i, npos, false);
+
+        while (!calls.empty())
+        {
+            auto [curr, parent, expanded] = calls.back();
+            calls.pop_back();
+
+            if (!expanded)
+            {
+                if (ip_vec[curr] != -1)
+                {
+                    if (visited[curr])
+                    {
+                        ll_vec[parent] = std::min(ll_vec[parent], ll_vec[curr]);
+                    }
+
+                    continue;
+                }
+
+                ip_vec[curr] = ll_vec[curr] = ip++;
+                st.push(curr);
+                visited[curr] = true;
+
+                calls.emplace_back(curr, parent, true);
+
+                size_t first = calls.size();
+                storage.forEach(curr, [&](const size_t& elem, const weight_type&)
+                {
+                    calls.emplace_back(elem, curr, false);
+                });
+
+                std::reverse(calls.begin() + first, calls.end());
+
+                continue;
+            }
+
+            if (parent != npos)
+            {
+                ll_vec[parent] = std::min(ll_vec[parent], ll_vec[curr]);
+            }
+
+            if (ip_vec[curr] == ll_vec[curr])
+            {
+                result.emplace_back();
+                while (!st.empty() && st.top() != curr)
+                {
+                    result.back().push_back(st.top());
+                    visited[st.top()] = false;
+                    st.pop();
+                }
+
+                if (!st.empty())
+                {
+                    result.back().push_back(st.top());
+                    visited[st.top()] = false;
+                    st.pop();
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+std::vector<long long> BasicGraph<Storage, Weighted, Directed>::SSSP(const size_t& source) const
+{
+    std::vector<size_t> topo_sort = topoKahn();
+
+    if (topo_sort.empty())
+    {
+        return std::vector<long long>();
+    }
+
+    std::vector<long long> result(storage.size(), std::numeric_limits<long long>::max());
+    result[source] = 0;
+
+    for (auto& val : topo_sort)
+    {
+        if (result[val] != std::numeric_limits<long long>::max())
+        {
+            storage.forEach(val, [&](const size_t& elem, const weight_type& w)
+            {
+                result[elem] = std::min(result[elem], result[val] + w);
+            });
+        }
+    }
+
+    return result;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+std::vector<std::pair<std::vector<size_t>, long long>> BasicGraph<Storage, Weighted, Directed>::dijkstra(const size_t& source, QueueType queue) const
+{
+    PathTree tree = dijkstraTree(source, queue);
+
+    std::vector<std::pair<std::vector<size_t>, long long>> result(storage.size(), {std::vector<size_t>(), std::numeric_limits<long long>::max()});
+    for (size_t i = 0; i < storage.size(); ++i)
+    {
+        if (tree.distances[i] != std::numeric_limits<long long>::max())
+        {
+            result[i] = {getPath(tree, i), tree.distances[i]};
+        }
+    }
+
+    return result;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+PathTree BasicGraph<Storage, Weighted, Directed>::dijkstraTree(const size_t& source, QueueType queue) const
+{
+    PathTree tree;
+    tree.distances.assign(storage.size(), std::numeric_limits<long long>::max());
+    tree.parents.assign(storage.size(), npos);
+
+    tree.distances[source] = 0;
+
+    // with unit weights the settle order of a plain BFS already is the Dijkstra order
+    if constexpr (!Weighted)
+    {
+        std::queue<size_t> indexes;
+        indexes.push(source);
+
+        while (!indexes.empty())
+        {
+            size_t curr = indexes.front();
+            indexes.pop();
+
+            storage.forEach(curr, [&](const size_t& elem, const weight_type&)
+            {
+                if (tree.distances[elem] == std::numeric_limits<long long>::max())
+                {
+                    tree.distances[elem] = tree.distances[curr] + 1;
+                    tree.parents[elem] = curr;
+
+                    indexes.push(elem);
+                }
+            });
+        }
+
+        return tree;
+    }
+
+    // a negative key would break the monotone queues, the cached bounds decide without scanning the edges
+    if (queue == QueueType::Buckets && lightest >= 0 && static_cast<size_t>(heaviest) < max_buckets)
+    {
+        BucketQueue buckets(static_cast<size_t>(heaviest) + 1);
+        return dijkstraMonotone(source, buckets);
+    }
+
+    if (queue != QueueType::Heap && lightest >= 0)
+    {
+        RadixHeap heap;
+        return dijkstraMonotone(source, heap);
+    }
+
+    // every vertex is queued at most once, a shorter distance lowers its key in place
+    IndexedHeap<long long> heap(storage.size());
+    heap.push(source, 0);
+
+    std::vector<bool> visited(storage.size(), false);
+
+    while (!heap.empty())
+    {
+        size_t curr = heap.top().second;
+        heap.pop();
+
+        visited[curr] = true;
+
+        storage.forEach(curr, [&](const size_t& elem, const weight_type& w)
+        {
+            if (!visited[elem] && tree.distances[curr] + w < tree.distances[elem])
+            {
+                // only the parent is recorded, paths are rebuilt on demand by getPath
+                tree.distances[elem] = tree.distances[curr] + w;
+                tree.parents[elem] = curr;
+
+                heap.push(elem, tree.distances[elem]);
+            }
+        });
+    }
+
+    return tree;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+template <typename Queue>
+PathTree BasicGraph<Storage, Weighted, Directed>::dijkstraMonotone(const size_t& source, Queue& queue) const
+{
+    PathTree tree;
+    tree.distances.assign(storage.size(), std::numeric_limits<long long>::max());
+    tree.parents.assign(storage.size(), npos);
+
+    tree.distances[source] = 0;
+    queue.push(0, source);
+
+    std::vector<bool> visited(storage.size(), false);
+
+    // the queues can't lower a key, so a vertex may be queued several times and only its first pop counts
+    while (!queue.empty())
+    {
+        size_t curr = queue.pop().second;
+
+        if (visited[curr])
+        {
+            continue;
+        }
+
+        visited[curr] = true;
+
+        storage.forEach(curr, [&](const size_t& elem, const weight_type& w)
+        {
+            if (!visited[elem] && tree.distances[curr] + w < tree.distances[elem])
+            {
+                tree.distances[elem] = tree.distances[curr] + w;
+                tree.parents[elem] = curr;
+
+                queue.push(tree.distances[elem], elem);
+            }
+        });
+    }
+
+    return tree;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+PathTree BasicGraph<Storage, Weighted, Directed>::dijkstraTreeTo(const size_t& target) const
+{
+    Storage copy;
+    const Storage* tp = reversed(copy);
+
+    PathTree tree;
+    tree.distances.assign(storage.size(), std::numeric_limits<long long>::max());
+    tree.parents.assign(storage.size(), npos);
+
+    tree.distances[target] = 0;
+
+    IndexedHeap<long long> heap(storage.size());
+    heap.push(target, 0);
+
+    std::vector<bool> visited(storage.size(), false);
+
+    while (!heap.empty())
+    {
+        size_t curr = heap.top().second;
+        heap.pop();
+
+        visited[curr] = true;
+
+        forEachIn(tp, curr, [&](const size_t& elem, const weight_type& w)
+        {
+            if (!visited[elem] && tree.distances[curr] + w < tree.distances[elem])
+            {
+                tree.distances[elem] = tree.distances[curr] + w;
+                tree.parents[elem] = curr;
+
+                heap.push(elem, tree.distances[elem]);
+            }
+        });
+    }
+
+    return tree;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+std::vector<size_t> BasicGraph<Storage, Weighted, Directed>::getPath(const PathTree& tree, size_t dest) const
+{
+    if (tree.distances[dest] == std::numeric_limits<long long>::max() || tree.distances[dest] == std::numeric_limits<long long>::min())
+    {
+        return std::vector<size_t>();
+    }
+
+    return constructPath(tree.parents, dest);
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+std::pair<std::vector<size_t>, long long> BasicGraph<Storage, Weighted, Directed>::shortestPath(const size_t& source, const size_t& target) const
+{
+    if (source == target)
+    {
+        return {{source}, 0};
+    }
+
+    // without cheap in-edges the backward side would need a transposed copy per query, a forward search
+    // that stops at target (A* without a heuristic) costs less than that
+    if (Directed && !incoming && !storage.scansColumns())
+    {
+        SearchResult result = astar(source, target, [](const size_t&)
+        {
+            return 0;
+        });
+
+        return {result.path, result.distance};
+    }
+
+    // side 0 searches forward from source over out-edges, side 1 backward from target over in-edges
+    Storage copy;
+    const Storage* tp = reversed(copy);
+
+    std::vector<long long> distances[2];
+    std::vector<size_t> parents[2];
+    std::vector<bool> visited[2];
+    IndexedHeap<long long> heaps[2] = {IndexedHeap<long long>(storage.size()), IndexedHeap<long long>(storage.size())};
+
+    size_t ends[2] = {source, target};
+    for (size_t side = 0; side < 2; ++side)
+    {
+        distances[side].assign(storage.size(), std::numeric_limits<long long>::max());
+        parents[side].assign(storage.size(), npos);
+        visited[side].assign(storage.size(), false);
+
+        distances[side][ends[side]] = 0;
+        heaps[side].push(ends[side], 0);
+    }
+
+    long long best = std::numeric_limits<long long>::max();
+    size_t meet = npos;
+
+    // once the two smallest keys add up to the best meeting found, no unsettled vertex can improve it
+    while (!heaps[0].empty() && !heaps[1].empty() && heaps[0].top().first + heaps[1].top().first < best)
+    {
+        size_t side = heaps[0].top().first <= heaps[1].top().first ? 0 : 1;
+        size_t other = 1 - side;
+
+        size_t curr = heaps[side].top().second;
+        heaps[side].pop();
+
+        visited[side][curr] = true;
+
+        auto relax = [&](const size_t& elem, const weight_type& w)
+        {
+            if (!visited[side][elem] && distances[side][curr] + w < distances[side][elem])
+            {
+                distances[side][elem] = distances[side][curr] + w;
+                parents[side][elem] = curr;
+
+                heaps[side].push(elem, distances[side][elem]);
+            }
+
+            if (distances[other][elem] != std::numeric_limits<long long>::max() &&
+                distances[side][elem] + distances[other][elem] < best)
+            {
+                best = distances[side][elem] + distances[other][elem];
+                meet = elem;
+            }
+        };
+
+        if (side == 0)
+        {
+            storage.forEach(curr, relax);
+        }
+        else
+        {
+            forEachIn(tp, curr, relax);
+        }
+    }
+
+    if (meet == npos)
+    {
+        return {std::vector<size_t>(), std::numeric_limits<long long>::max()};
+    }
+
+    // source..meet comes from the forward tree, meet..target follows the backward parents
+    size_t curr = meet;
+    std::vector<size_t> path = constructPath(parents[0], curr);
+    for (curr = parents[1][meet]; curr != npos; curr = parents[1][curr])
+    {
+        path.push_back(curr);
+    }
+
+    return {path, best};
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+template <typename Heuristic>
+SearchResult BasicGraph<Storage, Weighted, Directed>::astar(const size_t& source, const size_t& target, Heuristic heuristic) const
+{
+    SearchResult result{std::vector<size_t>(), std::numeric_limits<long long>::max(), 0};
+
+    std::vector<long long> distances(storage.size(), std::numeric_limits<long long>::max());
+    std::vector<long long> estimates(storage.size(), 0); // heuristic(v), evaluated once when v is first reached
+    std::vector<size_t> parents(storage.size(), npos);
+
+    distances[source] = 0;
+    estimates[source] = static_cast<long long>(heuristic(source));
+
+    // keyed by distance + estimate, a settled vertex that is reached again by a shorter path (only possible
+    // with an inconsistent heuristic) is pushed back and expanded again
+    IndexedHeap<long long> heap(storage.size());
+    heap.push(source, estimates[source]);
+
+    while (!heap.empty())
+    {
+        size_t curr = heap.top().second;
+        heap.pop();
+
+        ++result.settled;
+
+        if (curr == target)
+        {
+            size_t dest = target;
+            result.path = constructPath(parents, dest);
+            result.distance = distances[target];
+
+            break;
+        }
+
+        storage.forEach(curr, [&](const size_t& elem, const weight_type& w)
+        {
+            if (distances[curr] + w < distances[elem])
+            {
+                if (distances[elem] == std::numeric_limits<long long>::max())
+                {
+                    estimates[elem] = static_cast<long long>(heuristic(elem));
+                }
+
+                distances[elem] = distances[curr] + w;
+                parents[elem] = curr;
+
+                heap.push(elem, distances[elem] + estimates[elem]);
+            }
+        });
+    }
+
+    return result;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+std::vector<std::pair<std::vector<size_t>, long long>> BasicGraph<Storage, Weighted, Directed>::bellmanFord(const size_t& source) const
+{
+    std::vector<size_t> cycle;
+    PathTree tree = bellmanFordTree(source, cycle);
+
+    std::vector<std::pair<std::vector<size_t>, long long>> result(storage.size(), {std::vector<size_t>(), std::numeric_limits<long long>::max()});
+    for (size_t i = 0; i < storage.size(); ++i)
+    {
+        result[i] = {getPath(tree, i), tree.distances[i]};
+    }
+
+    return result;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+PathTree BasicGraph<Storage, Weighted, Directed>::bellmanFordTree(const size_t& source, std::vector<size_t>& cycle) const
+{
+    return bellmanFordFrom({source}, cycle);
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+PathTree BasicGraph<Storage, Weighted, Directed>::bellmanFordFrom(const std::vector<size_t>& sources, std::vector<size_t>& cycle) const
+{
+    const long long unreached = std::numeric_limits<long long>::max();
+    const long long unbounded = std::numeric_limits<long long>::min();
+
+    PathTree tree;
+    tree.distances.assign(storage.size(), unreached);
+    tree.parents.assign(storage.size(), npos);
+
+    cycle.clear();
+
+    // lengths[v] counts the edges of the walk behind distances[v], a negative cycle is the only way
+    // for it to reach the vertex count
+    std::vector<size_t> lengths(storage.size(), 0);
+    std::vector<size_t> stamps(storage.size(), 0);
+    size_t stamp = 0;
+
+    std::vector<bool> queued(storage.size(), false);
+    std::queue<size_t> queue;
+
+    for (auto& source : sources)
+    {
+        tree.distances[source] = 0;
+        queued[source] = true;
+        queue.push(source);
+    }
+
+    // only vertices whose distance dropped get rescanned, so the loop ends as soon as a round changes nothing
+    while (!queue.empty())
+    {
+        size_t curr = queue.front();
+        queue.pop();
+
+        queued[curr] = false;
+
+        storage.forEach(curr, [&](const size_t& elem, const weight_type& w)
+        {
+            // curr itself may have been found to sit behind a negative cycle by an earlier edge
+            if (tree.distances[curr] == unbounded ||
+                tree.distances[elem] == unbounded || tree.distances[curr] + w >= tree.distances[elem])
+            {
+                return;
+            }
+
+            tree.distances[elem] = tree.distances[curr] + w;
+            tree.parents[elem] = curr;
+            lengths[elem] = lengths[curr] + 1;
+
+            if (lengths[elem] < storage.size())
+            {
+                if (!queued[elem])
+                {
+                    queued[elem] = true;
+                    queue.push(elem);
+                }
+
+                return;
+            }
+
+            // a negative cycle exists, once it has closed in the parents a walk up from elem runs into it
+            ++stamp;
+            size_t on_cycle = elem;
+            while (on_cycle != npos && stamps[on_cycle] != stamp)
+            {
+                stamps[on_cycle] = stamp;
+                on_cycle = tree.parents[on_cycle];
+            }
+
+            if (on_cycle == npos)
+            {
+                if (!queued[elem])
+                {
+                    queued[elem] = true;
+                    queue.push(elem);
+                }
+
+                return;
+            }
+
+            if (cycle.empty())
+            {
+                for (size_t v = tree.parents[on_cycle]; cycle.empty() || cycle.back() != on_cycle; v = tree.parents[v])
+                {
+                    cycle.push_back(v);
+                }
+
+                std::reverse(cycle.begin(), cycle.end());
+            }
+
+            // everything the cycle reaches is unbounded, those vertices drop out of the tree and the search,
+            // the remaining ones keep converging to their exact distances
+            std::stack<size_t> st;
+            st.push(on_cycle);
+            tree.distances[on_cycle] = unbounded;
+            tree.parents[on_cycle] = npos;
+
+            while (!st.empty())
+            {
+                size_t top = st.top();
+                st.pop();
+
+                storage.forEach(top, [&](const size_t& next, const weight_type&)
+                {
+                    if (tree.distances[next] != unbounded)
+                    {
+                        tree.distances[next] = unbounded;
+                        tree.parents[next] = npos;
+                        st.push(next);
+                    }
+                });
+            }
+        });
+    }
+
+    return tree;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+std::vector<long long> BasicGraph<Storage, Weighted, Directed>::bellmanFordParallel(const size_t& source, size_t threads) const
+{
+    const long long unreached = std::numeric_limits<long long>::max();
+    const long long unbounded = std::numeric_limits<long long>::min();
+
+    const size_t n = storage.size();
+
+    // in-edges grouped by target as flat arrays: sources/weights[offsets[v]..offsets[v + 1]) lead into v
+    std::vector<size_t> offsets(n + 1, 0);
+    for (size_t i = 0; i < n; ++i)
+    {
+        storage.forEach(i, [&](const size_t& elem, const weight_type&)
+        {
+            ++offsets[elem + 1];
+        });
+    }
+
+    prefixSum(offsets, threads);
+
+    std::vector<vertex_type> sources(offsets.back());
+    std::vector<long long> weights(offsets.back());
+
+    std::vector<size_t> pos(offsets.begin(), offsets.end() - 1);
+    for (size_t i = 0; i < n; ++i)
+    {
+        storage.forEach(i, [&](const size_t& elem, const weight_type& w)
+        {
+            sources[pos[elem]] = i;
+            weights[pos[elem]] = w;
+            ++pos[elem];
+        });
+    }
+
+    // every thread owns a range of targets holding about the same number of edges, so each distance has a single
+    // writer and a round reads current while writing next, no compare-and-swap is needed
+    size_t blocks = std::max<size_t>(1, std::min(threads, n));
+    std::vector<size_t> bounds(blocks + 1, n);
+    for (size_t b = 0; b < blocks; ++b)
+    {
+        bounds[b] = std::lower_bound(offsets.begin(), offsets.end() - 1, offsets.back() * b / blocks) - offsets.begin();
+    }
+
+    std::vector<long long> current(n, unreached);
+    current[source] = 0;
+    std::vector<long long> next = current;
+
+    // round k leaves the shortest distances over at most k edges, so without a negative cycle nothing changes
+    // by round n, the barrier's completion step swaps the buffers and decides whether to go on
+    std::atomic<bool> changed = false;
+    bool done = false;
+    bool negative = false;
+    size_t round = 0;
+
+    std::barrier sync(blocks, [&]() noexcept
+    {
+        std::swap(current, next);
+        ++round;
+
+        negative = changed && round == n;
+        done = !changed || round == n;
+        changed = false;
+    });
+
+    auto worker = [&](const size_t& b)
+    {
+        while (!done)
+        {
+            bool local = false;
+            for (size_t v = bounds[b]; v < bounds[b + 1]; ++v)
+            {
+                long long best = current[v];
+                for (size_t k = offsets[v]; k < offsets[v + 1]; ++k)
+                {
+                    long long dist = current[sources[k]];
+                    best = std::min(best, dist == unreached ? unreached : dist + weights[k]);
+                }
+
+                local = local || best != current[v];
+                next[v] = best;
+            }
+
+            if (local)
+            {
+                changed.store(true, std::memory_order_relaxed);
+            }
+
+            sync.arrive_and_wait();
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (size_t b = 1; b < blocks; ++b)
+    {
+        pool.emplace_back(worker, b);
+    }
+
+    worker(0);
+
+    for (auto& thread : pool)
+    {
+        thread.join();
+    }
+
+    if (negative)
+    {
+        // an edge that still relaxes after n rounds leads into a negative cycle, whatever it reaches is unbounded
+        std::stack<size_t> st;
+        for (size_t v = 0; v < n; ++v)
+        {
+            for (size_t k = offsets[v]; k < offsets[v + 1]; ++k)
+            {
+                if (current[sources[k]] != unreached && current[sources[k]] + weights[k] < current[v])
+                {
+                    st.push(v);
+                    break;
+                }
+            }
+        }
+
+        while (!st.empty())
+        {
+            size_t top = st.top();
+            st.pop();
+
+            if (current[top] == unbounded)
+            {
+                continue;
+            }
+
+            current[top] = unbounded;
+            storage.forEach(top, [&](const size_t& elem, const weight_type&)
+            {
+                if (current[elem] != unbounded)
+                {
+                    st.push(elem);
+                }
+            });
+        }
+    }
+
+    return current;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+template <typename Callback>
+bool BasicGraph<Storage, Weighted, Directed>::johnson(Callback callback, size_t threads) const
+{
+    const long long unreached = std::numeric_limits<long long>::max();
+    const size_t n = storage.size();
+
+    std::vector<size_t> sources(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        sources[i] = i;
+    }
+
+    std::vector<size_t> cycle;
+    std::vector<long long> potentials = bellmanFordFrom(sources, cycle).distances;
+
+    if (!cycle.empty())
+    {
+        return false;
+    }
+
+    // reweighted copy in CSR form, w(u, v) + potentials[u] - potentials[v] is never negative
+    std::vector<size_t> offsets(n + 1, 0);
+    for (size_t i = 0; i < n; ++i)
+    {
+        offsets[i + 1] = offsets[i] + storage.degree(i);
+    }
+
+    std::vector<vertex_type> targets(offsets.back());
+    std::vector<long long> weights(offsets.back());
+    for (size_t i = 0; i < n; ++i)
+    {
+        size_t pos = offsets[i];
+        storage.forEach(i, [&](const size_t& elem, const weight_type& w)
+        {
+            targets[pos] = elem;
+            weights[pos] = w + potentials[i] - potentials[elem];
+            ++pos;
+        });
+    }
+
+    // every worker keeps its own buffers and takes the next unclaimed source until none are left
+    std::atomic<size_t> next = 0;
+    auto worker = [&]()
+    {
+        std::vector<long long> distances(n);
+        std::vector<bool> visited(n);
+        IndexedHeap<long long> heap(n);
+
+        for (size_t source = next++; source < n; source = next++)
+        {
+            std::fill(distances.begin(), distances.end(), unreached);
+            std::fill(visited.begin(), visited.end(), false);
+
+            distances[source] = 0;
+            heap.push(source, 0);
+
+            while (!heap.empty())
+            {
+                size_t curr = heap.top().second;
+                heap.pop();
+
+                visited[curr] = true;
+
+                for (size_t pos = offsets[curr]; pos < offsets[curr + 1]; ++pos)
+                {
+                    size_t elem = targets[pos];
+                    if (!visited[elem] && distances[curr] + weights[pos] < distances[elem])
+                    {
+                        distances[elem] = distances[curr] + weights[pos];
+                        heap.push(elem, distances[elem]);
+                    }
+                }
+            }
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                if (distances[i] != unreached)
+                {
+                    distances[i] += potentials[i] - potentials[source];
+                }
+            }
+
+            callback(source, std::as_const(distances));
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (size_t t = 1; t < std::min(threads, n); ++t)
+    {
+        pool.emplace_back(worker);
+    }
+
+    worker();
+
+    for (auto& thread : pool)
+    {
+        thread.join();
+    }
+
+    return true;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+bool BasicGraph<Storage, Weighted, Directed>::johnsonMatrix(std::vector<long long>& distances, size_t threads) const
+{
+    const size_t n = storage.size();
+    distances.assign(n * n, std::numeric_limits<long long>::max());
+
+    return johnson([&](const size_t& source, const std::vector<long long>& row)
+    {
+        std::copy(row.begin(), row.end(), distances.begin() + source * n);
+    }, threads);
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+bool BasicGraph<Storage, Weighted, Directed>::johnsonMatrix(const std::string& path, size_t threads) const
+{
+    const size_t n = storage.size();
+    const size_t length = n * n * sizeof(long long);
+
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    if (ftruncate(fd, length) != 0)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    if (!length)
+    {
+        ::close(fd);
+        return true;
+    }
+
+    // rows go straight into the page cache, the kernel writes them back as memory gets tight
+    void* data = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+
+    if (data == MAP_FAILED)
+    {
+        return false;
+    }
+
+    long long* distances = static_cast<long long*>(data);
+    bool result = johnson([&](const size_t& source, const std::vector<long long>& row)
+    {
+        std::copy(row.begin(), row.end(), distances + source * n);
+    }, threads);
+
+    munmap(data, length);
+
+    return result;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+std::vector<long long> BasicGraph<Storage, Weighted, Directed>::deltaStepping(const size_t& source, long long delta, size_t threads) const
+{
+    const long long unreached = std::numeric_limits<long long>::max();
+
+    long long total = 0;
+    long long heaviest = 0;
+    for (size_t i = 0; i < storage.size(); ++i)
+    {
+        storage.forEach(i, [&](const size_t&, const weight_type& w)
+        {
+            total += w;
+            heaviest = std::max<long long>(heaviest, w);
+        });
+    }
+
+    if (delta <= 0)
+    {
+        delta = std::max<long long>(1, total / std::max<size_t>(1, edgeCount()));
+    }
+
+    std::vector<std::atomic<long long>> dist(storage.size());
+    for (auto& elem : dist)
+    {
+        elem.store(unreached, std::memory_order_relaxed);
+    }
+
+    dist[source].store(0, std::memory_order_relaxed);
+
+    // every worker owns the vertices v with v % blocks == its number: it alone queues them, filters them out of
+    // the buckets and merges the requests made for them, so queued needs no synchronisation
+    size_t blocks = std::max<size_t>(1, std::min(threads, storage.size()));
+
+    // while bucket i is processed every tentative distance lies below (i + 1) * delta + heaviest, so only
+    // ceil(heaviest / delta) + 1 buckets are ever live and bucket i sits in slot i % count. buckets[slot][b] holds
+    // the vertices of worker b, entries whose distance dropped into an earlier bucket since are stale and skipped
+    size_t count = static_cast<size_t>((heaviest + delta - 1) / delta) + 1;
+    std::vector<std::vector<std::vector<size_t>>> buckets(count, std::vector<std::vector<size_t>>(blocks));
+    std::vector<size_t> queued(storage.size(), npos);
+
+    buckets[0][source % blocks].push_back(source);
+    queued[source] = 0;
+
+    // requests[src][dst]: vertices worker src lowered the distance of that belong to worker dst, a request is only
+    // made after an atomic min actually lowered the distance
+    std::vector<std::vector<std::vector<size_t>>> requests(blocks, std::vector<std::vector<size_t>>(blocks));
+
+    auto relax = [&](const std::vector<size_t>& frontier, bool light, std::vector<std::vector<size_t>>& outbox)
+    {
+        for (size_t curr : frontier)
+        {
+            long long base = dist[curr].load(std::memory_order_relaxed);
+
+            storage.forEach(curr, [&](const size_t& elem, const weight_type& w)
+            {
+                if ((w <= delta) != light)
+                {
+                    return;
+                }
+
+                long long candidate = base + w;
+                long long seen = dist[elem].load(std::memory_order_relaxed);
+                while (candidate < seen)
+                {
+                    if (dist[elem].compare_exchange_weak(seen, candidate, std::memory_order_relaxed))
+                    {
+                        outbox[elem % blocks].push_back(elem);
+                        break;
+                    }
+                }
+            });
+        }
+    };
+
+    // light edges can land back in bucket i, so it is drained in light phases until it stays empty, then one heavy
+    // phase relaxes the heavy edges of everything settled in it, those leave bucket i for good
+    size_t i = 0;
+    bool heavy = false;
+    bool done = false;
+
+    auto pending = [&](const size_t& slot)
+    {
+        return std::any_of(buckets[slot].begin(), buckets[slot].end(), [](const std::vector<size_t>& part)
+        {
+            return !part.empty();
+        });
+    };
+
+    // a phase is relax, barrier, merge, barrier, the completion of the second one picks the next phase
+    std::barrier<> relaxed(blocks);
+    std::barrier merged(blocks, [&]() noexcept
+    {
+        if (!heavy)
+        {
+            heavy = !pending(i % count);
+            return;
+        }
+
+        heavy = false;
+
+        size_t step = 1;
+        while (step < count && !pending((i + step) % count))
+        {
+            ++step;
+        }
+
+        done = step == count;
+        i += step;
+    });
+
+    auto worker = [&](const size_t& b)
+    {
+        std::vector<size_t> frontier;
+        std::vector<size_t> settled;
+
+        while (!done)
+        {
+            if (heavy)
+            {
+                std::sort(settled.begin(), settled.end());
+                settled.erase(std::unique(settled.begin(), settled.end()), settled.end());
+
+                relax(settled, false, requests[b]);
+                settled.clear();
+            }
+
+            else
+            {
+                // the slot's lists keep their capacity for the buckets that reuse it
+                frontier.clear();
+                for (size_t elem : buckets[i % count][b])
+                {
+                    if (queued[elem] == i && static_cast<size_t>(dist[elem].load(std::memory_order_relaxed) / delta) == i)
+                    {
+                        queued[elem] = npos;
+                        frontier.push_back(elem);
+                    }
+                }
+
+                buckets[i % count][b].clear();
+
+                relax(frontier, true, requests[b]);
+                settled.insert(settled.end(), frontier.begin(), frontier.end());
+            }
+
+            relaxed.arrive_and_wait();
+
+            for (size_t src = 0; src < blocks; ++src)
+            {
+                for (size_t elem : requests[src][b])
+                {
+                    size_t index = static_cast<size_t>(dist[elem].load(std::memory_order_relaxed) / delta);
+                    if (queued[elem] != index)
+                    {
+                        queued[elem] = index;
+                        buckets[index % count][b].push_back(elem);
+                    }
+                }
+
+                requests[src][b].clear();
+            }
+
+            merged.arrive_and_wait();
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (size_t b = 1; b < blocks; ++b)
+    {
+        pool.emplace_back(worker, b);
+    }
+
+    worker(0);
+
+    for (auto& thread : pool)
+    {
+        thread.join();
+    }
+
+    std::vector<long long> result(storage.size());
+    for (size_t v = 0; v < storage.size(); ++v)
+    {
+        result[v] = dist[v].load(std::memory_order_relaxed);
+    }
+
+    return result;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+BasicGraph<Storage, Weighted, Directed> BasicGraph<Storage, Weighted, Directed>::Prim() const requires EditableStorage<Storage>
+{
+    BasicGraph result;
+    result.addVertex(storage.size());
+
+    // the key of a queued vertex is the lightest edge from the tree to it, parents[v] is that edge's tree end
+    IndexedHeap<weight_type> heap(storage.size());
+    std::vector<size_t> parents(storage.size(), npos);
+
+    std::vector<bool> visited(storage.size(), false);
+    for (size_t i = 0; i < storage.size(); ++i)
+    {
+        if (visited[i])
+        {
+            continue;
+        }
+
+        heap.push(i, 0);
+
+        while (!heap.empty())
+        {
+            auto [w, curr] = heap.top();
+            heap.pop();
+
+            visited[curr] = true;
+
+            if (parents[curr] != npos)
+            {
+                result.addEdge(parents[curr], curr, w);
+            }
+
+            storage.forEach(curr, [&](const size_t& elem, const weight_type& weight)
+            {
+                if (!visited[elem] && heap.push(elem, weight))
+                {
+                    parents[elem] = curr;
+                }
+            });
+        }
+    }
+
+    return result;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+BasicGraph<Storage, Weighted, Directed>::Union::Union(const size_t& size) : parents(std::vector<vertex_type>(size)), sizes(std::vector<vertex_type>(size, 1))
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        parents[i] = i;
+    }
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+size_t BasicGraph<Storage, Weighted, Directed>::Union::findParent(const size_t& u)
+{
+    if (parents[u] != u)
+    {
+        parents[u] = findParent(parents[u]);
+    }
+
+    return parents[u];
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+bool BasicGraph<Storage, Weighted, Directed>::Union::unionFind(const size_t& u, const size_t& v)
+{
+    size_t p1 = findParent(u);
+    size_t p2 = findParent(v);
+
+    if (p1 == p2)
+    {
+        return false;
+    }
+
+    if (sizes[p1] < sizes[p2])
+    {
+        std::swap(p1, p2);
+    }
+
+    sizes[p1] += sizes[p2];
+    parents[p2] = p1;
+
+    return true;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+BasicGraph<Storage, Weighted, Directed> BasicGraph<Storage, Weighted, Directed>::Kruskal() const requires EditableStorage<Storage>
+{
+    std::vector<std::tuple<vertex_type, vertex_type, weight_type>> edges;
+    for (size_t i = 0; i < storage.size(); ++i)
+    {
+        storage.forEach(i, [&](const size_t& elem, const weight_type& w)
+        {
+            edges.emplace_back(i, elem, w);
+        });
+    }
+
+    std::sort(edges.begin(), edges.end(), [](const std::tuple<vertex_type, vertex_type, weight_type>& edge1,
+                                             const std::tuple<vertex_type, vertex_type, weight_type>& edge2)
+    {
+        return std::get<2>(edge1) < std::get<2>(edge2);
+    });
+
+    Union un(storage.size());
+
+    BasicGraph result;
+    result.addVertex(storage.size());
+
+    for (auto& [index1, index2, w] : edges)
+    {
+        if (un.unionFind(index1, index2))
+        {
+            result.addEdge(index1, index2, w);
+        }
+    }
+
+    return result;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+typename BasicGraph<Storage, Weighted, Directed>::CSR BasicGraph<Storage, Weighted, Directed>::freeze() const
+{
+    CSR result;
+
+    std::vector<size_t> offsets(storage.size() + 1, 0);
+    for (size_t i = 0; i < storage.size(); ++i)
+    {
+        offsets[i + 1] = offsets[i] + storage.degree(i);
+    }
+
+    std::vector<std::pair<vertex_type, weight_type>> row;
+    result.storage.assign(offsets, 1, [&](const size_t& i, auto&& f)
+    {
+        row.clear();
+        storage.forEach(i, [&](const size_t& elem, const weight_type& w)
+        {
+            row.emplace_back(elem, w);
+        });
+
+        std::sort(row.begin(), row.end()); // sorted targets keep the visited[] accesses of a scan monotonic
+
+        for (auto& [elem, w] : row)
+        {
+            f(elem, w);
+        }
+    });
+
+    result.removed = removed;
+    result.free_ids = free_ids;
+    result.removed_count = removed_count;
+    result.lightest = lightest;
+    result.heaviest = heaviest;
+
+    return result;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+typename BasicGraph<Storage, Weighted, Directed>::Hierarchy BasicGraph<Storage, Weighted, Directed>::contract() const
+{
+    const size_t n = storage.size();
+    if (!n)
+    {
+        return Hierarchy();
+    }
+
+    struct Arc
+    {
+        size_t target;
+        long long weight;
+        size_t middle; // the contracted vertex a shortcut bypasses, npos for original edges
+    };
+
+    // remaining graph while contracting, a contracted vertex hands its arcs over to the hierarchy and is
+    // unlinked from its neighbours, so the searches below only ever see uncontracted vertices
+    std::vector<std::vector<Arc>> out(n);
+    std::vector<std::vector<Arc>> in(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        storage.forEach(i, [&](const size_t& elem, const weight_type& w)
+        {
+            if (elem != i)
+            {
+                out[i].push_back({elem, w, npos});
+                in[elem].push_back({i, w, npos});
+            }
+        });
+    }
+
+    std::vector<std::vector<Arc>> up_rows(n);
+    std::vector<std::vector<Arc>> down_rows(n);
+
+    std::vector<size_t> neighbours(n, 0); // contracted neighbours, spreads the order evenly over the graph
+
+    // dijkstra from source that avoids via and stops once the targets of via are settled, or gives up past limit
+    // or after cap vertices (fewer while only estimating a priority), a missed witness only costs a redundant
+    // shortcut, only touched entries are reset so every search stays local
+    const size_t apply_cap = 500;
+    const size_t estimate_cap = 50;
+    std::vector<long long> witness(n, std::numeric_limits<long long>::max());
+    std::vector<size_t> touched;
+    std::vector<bool> targets(n, false);
+
+    auto witnessSearch = [&](const size_t& source, const size_t& via, const long long& limit, size_t remaining, const size_t& cap)
+    {
+        for (auto& elem : touched)
+        {
+            witness[elem] = std::numeric_limits<long long>::max();
+        }
+        touched.clear();
+
+        std::priority_queue<std::pair<long long, size_t>, std::vector<std::pair<long long, size_t>>, std::greater<std::pair<long long, size_t>>> queue;
+
+        witness[source] = 0;
+        touched.push_back(source);
+        queue.push({0, source});
+
+        size_t settled = 0;
+        while (!queue.empty() && settled < cap)
+        {
+            auto [dist, curr] = queue.top();
+            queue.pop();
+
+            if (dist > limit)
+            {
+                break;
+            }
+
+            if (dist > witness[curr])
+            {
+                continue;
+            }
+
+            ++settled;
+
+            if (targets[curr] && !--remaining)
+            {
+                break;
+            }
+
+            for (auto& arc : out[curr])
+            {
+                if (arc.target != via && dist + arc.weight < witness[arc.target])
+                {
+                    if (witness[arc.target] == std::numeric_limits<long long>::max())
+                    {
+                        touched.push_back(arc.target);
+                    }
+
+                    witness[arc.target] = dist + arc.weight;
+                    queue.push({witness[arc.target], arc.target});
+                }
+            }
+        }
+    };
+
+    auto addArc = [&](const size_t& from, const size_t& to, const long long& weight, const size_t& middle)
+    {
+        for (auto& arc : out[from])
+        {
+            if (arc.target == to)
+            {
+                if (weight < arc.weight)
+                {
+                    arc = {to, weight, middle};
+                    for (auto& back : in[to])
+                    {
+                        if (back.target == from)
+                        {
+                            back = {from, weight, middle};
+                        }
+                    }
+                }
+
+                return;
+            }
+        }
+
+        out[from].push_back({to, weight, middle});
+        in[to].push_back({from, weight, middle});
+    };
+
+    auto unlink = [](std::vector<Arc>& arcs, const size_t& target)
+    {
+        for (size_t i = 0; i < arcs.size(); ++i)
+        {
+            if (arcs[i].target == target)
+            {
+                arcs[i] = arcs.back();
+                arcs.pop_back();
+
+                return;
+            }
+        }
+    };
+
+    // a shortcut u -> w replaces u -> v -> w unless a path avoiding v is at least as short,
+    // with apply unset the shortcuts are only counted
+    auto shortcutsOf = [&](const size_t& v, bool apply)
+    {
+        long long max_out = 0;
+        for (auto& arc : out[v])
+        {
+            max_out = std::max(max_out, arc.weight);
+            targets[arc.target] = true;
+        }
+
+        size_t added = 0;
+        for (size_t i = 0; i < in[v].size(); ++i)
+        {
+            Arc from = in[v][i];
+            witnessSearch(from.target, v, from.weight + max_out, out[v].size(), apply ? apply_cap : estimate_cap);
+
+            for (size_t j = 0; j < out[v].size(); ++j)
+            {
+                Arc to = out[v][j];
+                if (to.target == from.target || witness[to.target] <= from.weight + to.weight)
+                {
+                    continue;
+                }
+
+                ++added;
+                if (apply)
+                {
+                    addArc(from.target, to.target, from.weight + to.weight, v);
+                }
+            }
+        }
+
+        for (auto& arc : out[v])
+        {
+            targets[arc.target] = false;
+        }
+
+        return added;
+    };
+
+    // edge difference: shortcuts the contraction adds minus the arcs it removes
+    auto priority = [&](const size_t& v)
+    {
+        long long removed_arcs = out[v].size() + in[v].size();
+        return static_cast<long long>(shortcutsOf(v, false)) - removed_arcs + static_cast<long long>(neighbours[v]);
+    };
+
+    IndexedHeap<long long> heap(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        heap.push(i, priority(i));
+    }
+
+    Hierarchy result;
+    result.ranks.assign(n, 0);
+
+    size_t rank = 0;
+    while (!heap.empty())
+    {
+        size_t curr = heap.top().second;
+        heap.pop();
+
+        // lazy update: the stored priority may be stale, a vertex that got worse than the next one goes back
+        long long key = priority(curr);
+        if (!heap.empty() && key > heap.top().first)
+        {
+            heap.push(curr, key);
+            continue;
+        }
+
+        shortcutsOf(curr, true);
+
+        result.ranks[curr] = rank++;
+
+        // every remaining neighbour is ranked higher, so the arcs left at curr are its up and down arcs
+        for (auto& arc : out[curr])
+        {
+            unlink(in[arc.target], curr);
+        }
+        for (auto& arc : in[curr])
+        {
+            unlink(out[arc.target], curr);
+        }
+
+        up_rows[curr] = std::move(out[curr]);
+        down_rows[curr] = std::move(in[curr]);
+        out[curr].clear();
+        in[curr].clear();
+
+        // a neighbour on both sides (always, for undirected graphs) is updated once
+        std::vector<size_t> adjacent;
+        for (auto& arc : up_rows[curr])
+        {
+            adjacent.push_back(arc.target);
+        }
+        for (auto& arc : down_rows[curr])
+        {
+            adjacent.push_back(arc.target);
+        }
+
+        std::sort(adjacent.begin(), adjacent.end());
+        adjacent.erase(std::unique(adjacent.begin(), adjacent.end()), adjacent.end());
+
+        for (auto& elem : adjacent)
+        {
+            ++neighbours[elem];
+            heap.push(elem, priority(elem));
+        }
+    }
+
+    for (auto [arcs, rows] : {std::pair(&result.up, &up_rows), std::pair(&result.down, &down_rows)})
+    {
+        arcs->offsets.assign(n + 1, 0);
+        for (size_t i = 0; i < n; ++i)
+        {
+            arcs->offsets[i + 1] = arcs->offsets[i] + (*rows)[i].size();
+        }
+
+        arcs->targets.resize(arcs->offsets.back());
+        arcs->weights.resize(arcs->offsets.back());
+        arcs->middles.resize(arcs->offsets.back());
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            size_t pos = arcs->offsets[i];
+            for (auto& arc : (*rows)[i])
+            {
+                arcs->targets[pos] = arc.target;
+                arcs->weights[pos] = arc.weight;
+                arcs->middles[pos] = arc.middle == npos ? Hierarchy::none : static_cast<vertex_type>(arc.middle);
+                ++pos;
+
+                result.shortcuts += arc.middle != npos;
+            }
+        }
+    }
+
+    return result;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+const Storage& BasicGraph<Storage, Weighted, Directed>::getStorage() const
+{
+    return storage;
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+void BasicGraph<Storage, Weighted, Directed>::setThresholds(const double& to_matrix, const double& to_list)
+    requires requires (Storage& s, const double& d) { s.setThresholds(d, d); }
+{
+    storage.setThresholds(to_matrix, to_list);
+    if (incoming)
+    {
+        rev.setThresholds(to_matrix, to_list);
+    }
+}
+
+template <typename Storage, bool Weighted, bool Directed>
+bool BasicGraph<Storage, Weighted, Directed>::save(const std::string& path) const
+{
+    return writeGraphFile<vertex_type, weight_type>(path, storage.size(), Directed, Weighted,
+        [&](const size_t& i, std::vector<std::pair<vertex_type, weight_type>>& row)
+    {
+        storage.forEach(i, [&](const size_t& elem, const weight_type& w)
+        {
+            row.emplace_back(elem, w);
+        });
+
+        std::sort(row.begin(), row.end());
+    });
+}
\ No newline at end of file
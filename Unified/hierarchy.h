@@ -0,0 +1,83 @@
+#ifndef GRAPH_HIERARCHY_H
+#define GRAPH_HIERARCHY_H
+
+#include <cstdint>
+#include <vector>
+#include <stack>
+#include <queue>
+#include <utility>
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <fstream>
+#include <unordered_map>
+
+// contraction hierarchy: vertices are ranked and contracted in that order, shortcuts stand in for the paths
+// through contracted vertices, so a query only has to search upwards (to higher ranks) from both ends.
+// built once by BasicGraph::contract(), distances and unpacked paths match dijkstra's on the graph it was built from
+template <typename VertexId = size_t>
+class ContractionHierarchy
+{
+public:
+    typedef VertexId vertex_type;
+
+    ContractionHierarchy() = default;
+
+    size_t vertexCount() const;
+    size_t shortcutCount() const;
+
+    // max() when target is unreachable
+    long long distance(const size_t& source, const size_t& target) const;
+    std::pair<std::vector<size_t>, long long> shortestPath(const size_t& source, const size_t& target) const;
+
+    bool save(const std::string& path) const;
+    bool load(const std::string& path);
+
+private:
+    template <typename, bool, bool>
+    friend class BasicGraph;
+
+    static constexpr char MAGIC[8] = {'G', 'R', 'A', 'P', 'H', 'C', 'H', 'X'};
+    static constexpr uint32_t VERSION = 1;
+
+    struct FileHeader
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t vertex_bytes;
+        uint64_t vertices;
+        uint64_t shortcuts;
+        uint64_t up_arcs;
+        uint64_t down_arcs;
+    };
+
+    // arcs towards higher ranks in CSR form, middle is the contracted vertex a shortcut bypasses
+    // and none for original edges
+    struct Arcs
+    {
+        std::vector<size_t> offsets;
+        std::vector<vertex_type> targets;
+        std::vector<long long> weights;
+        std::vector<vertex_type> middles;
+    };
+
+    static constexpr vertex_type none = static_cast<vertex_type>(-1);
+    static constexpr size_t npos = static_cast<size_t>(-1); // no meeting vertex, no parent
+
+    // labels[0] is the forward search from source over up, labels[1] the backward one from target over
+    // down, each maps a reached vertex to (distance, parent), returns the best meeting vertex or npos
+    size_t search(const size_t& source, const size_t& target, long long& best,
+                std::unordered_map<size_t, std::pair<long long, size_t>> (&labels)[2]) const;
+
+    vertex_type middleOf(const size_t& from, const size_t& to) const;
+    void unpack(const size_t& from, const size_t& to, std::vector<size_t>& path) const;
+
+    std::vector<size_t> ranks;
+    Arcs up;   // up.targets of vertex i: out-edges i -> j with ranks[j] > ranks[i]
+    Arcs down; // down.targets of vertex i: in-edges j -> i with ranks[j] > ranks[i]
+    size_t shortcuts = 0;
+};
+
+#include "hierarchy.hpp"
+
+#endif
\ No newline at end of file
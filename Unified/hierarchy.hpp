@@ -0,0 +1,315 @@
+template <typename VertexId>
+size_t ContractionHierarchy<VertexId>::vertexCount() const
+{
+    return ranks.size();
+}
+
+template <typename VertexId>
+size_t ContractionHierarchy<VertexId>::shortcutCount() const
+{
+    return shortcuts;
+}
+
+template <typename VertexId>
+size_t ContractionHierarchy<VertexId>::search(const size_t& source, const size_t& target, long long& best,
+                                std::unordered_map<size_t, std::pair<long long, size_t>> (&labels)[2]) const
+{
+    best = std::numeric_limits<long long>::max();
+    size_t meet = npos;
+
+    const Arcs* arcs[2] = {&up, &down};
+    std::priority_queue<std::pair<long long, size_t>, std::vector<std::pair<long long, size_t>>, std::greater<std::pair<long long, size_t>>> queues[2];
+
+    size_t ends[2] = {source, target};
+    for (size_t side = 0; side < 2; ++side)
+    {
+        labels[side][ends[side]] = {0, npos};
+        queues[side].push({0, ends[side]});
+    }
+
+    // the highest ranked vertex of a shortest path is reached upwards from both ends, so each side
+    // only stops once its smallest key can't beat the best meeting found
+    while (true)
+    {
+        bool active[2];
+        for (size_t side = 0; side < 2; ++side)
+        {
+            active[side] = !queues[side].empty() && queues[side].top().first < best;
+        }
+
+        if (!active[0] && !active[1])
+        {
+            break;
+        }
+
+        size_t side = active[0] && (!active[1] || queues[0].top().first <= queues[1].top().first) ? 0 : 1;
+
+        auto [dist, curr] = queues[side].top();
+        queues[side].pop();
+
+        if (dist > labels[side][curr].first)
+        {
+            continue;
+        }
+
+        auto other = labels[1 - side].find(curr);
+        if (other != labels[1 - side].end() && dist + other->second.first < best)
+        {
+            best = dist + other->second.first;
+            meet = curr;
+        }
+
+        for (size_t pos = arcs[side]->offsets[curr]; pos < arcs[side]->offsets[curr + 1]; ++pos)
+        {
+            long long candidate = dist + arcs[side]->weights[pos];
+
+            auto [label, inserted] = labels[side].try_emplace(arcs[side]->targets[pos], candidate, curr);
+            if (inserted || candidate < label->second.first)
+            {
+                label->second = {candidate, curr};
+                queues[side].push({candidate, arcs[side]->targets[pos]});
+            }
+        }
+    }
+
+    return meet;
+}
+
+template <typename VertexId>
+long long ContractionHierarchy<VertexId>::distance(const size_t& source, const size_t& target) const
+{
+    // labels live in hash maps sized by the search space, so a query never touches O(V) memory
+    std::unordered_map<size_t, std::pair<long long, size_t>> labels[2];
+
+    long long best;
+    search(source, target, best, labels);
+
+    return best;
+}
+
+template <typename VertexId>
+std::pair<std::vector<size_t>, long long> ContractionHierarchy<VertexId>::shortestPath(const size_t& source, const size_t& target) const
+{
+    std::unordered_map<size_t, std::pair<long long, size_t>> labels[2];
+
+    long long best;
+    size_t meet = search(source, target, best, labels);
+
+    if (meet == npos)
+    {
+        return {std::vector<size_t>(), std::numeric_limits<long long>::max()};
+    }
+
+    std::vector<size_t> chain;
+    for (size_t curr = meet; curr != npos; curr = labels[0][curr].second)
+    {
+        chain.push_back(curr);
+    }
+
+    std::reverse(chain.begin(), chain.end());
+
+    std::vector<size_t> path = {source};
+    for (size_t i = 0; i + 1 < chain.size(); ++i)
+    {
+        unpack(chain[i], chain[i + 1], path);
+    }
+
+    for (size_t curr = meet; labels[1][curr].second != npos; curr = labels[1][curr].second)
+    {
+        unpack(curr, labels[1][curr].second, path);
+    }
+
+    return {path, best};
+}
+
+template <typename VertexId>
+typename ContractionHierarchy<VertexId>::vertex_type ContractionHierarchy<VertexId>::middleOf(const size_t& from, const size_t& to) const
+{
+    if (ranks[from] < ranks[to])
+    {
+        for (size_t pos = up.offsets[from]; pos < up.offsets[from + 1]; ++pos)
+        {
+            if (up.targets[pos] == to)
+            {
+                return up.middles[pos];
+            }
+        }
+    }
+    else
+    {
+        for (size_t pos = down.offsets[to]; pos < down.offsets[to + 1]; ++pos)
+        {
+            if (down.targets[pos] == from)
+            {
+                return down.middles[pos];
+            }
+        }
+    }
+
+    return none;
+}
+
+template <typename VertexId>
+void ContractionHierarchy<VertexId>::unpack(const size_t& from, const size_t& to, std::vector<size_t>& path) const
+{
+    // appends the original vertices after from up to to, a shortcut splits into the two arcs it was made of
+    std::stack<std::pair<size_t, size_t>> st;
+    st.push({from, to});
+
+    while (!st.empty())
+    {
+        auto [first, last] = st.top();
+        st.pop();
+
+        vertex_type middle = middleOf(first, last);
+        if (middle == none)
+        {
+            path.push_back(last);
+            continue;
+        }
+
+        st.push({middle, last});
+        st.push({first, middle});
+    }
+}
+
+template <typename VertexId>
+bool ContractionHierarchy<VertexId>::save(const std::string& path) const
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        return false;
+    }
+
+    FileHeader header = {};
+    std::copy(MAGIC, MAGIC + 8, header.magic);
+    header.version = VERSION;
+    header.vertex_bytes = sizeof(vertex_type);
+    header.vertices = ranks.size();
+    header.shortcuts = shortcuts;
+    header.up_arcs = up.targets.size();
+    header.down_arcs = down.targets.size();
+
+    auto write = [&](const auto& data)
+    {
+        file.write(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(data[0]));
+    };
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    write(ranks);
+    for (auto arcs : {&up, &down})
+    {
+        write(arcs->offsets);
+        write(arcs->targets);
+        write(arcs->weights);
+        write(arcs->middles);
+    }
+
+    file.close();
+
+    return !file.fail();
+}
+
+template <typename VertexId>
+bool ContractionHierarchy<VertexId>::load(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+
+    FileHeader header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        !std::equal(MAGIC, MAGIC + 8, header.magic) || header.version != VERSION || header.vertex_bytes != sizeof(vertex_type))
+    {
+        return false;
+    }
+
+    // the counts come from the file, so they are checked against its size before anything is allocated
+    // (divisions, so a hostile header can't overflow the sum)
+    file.seekg(0, std::ios::end);
+    uint64_t left = static_cast<uint64_t>(file.tellg()) - sizeof(header);
+    file.seekg(sizeof(header));
+
+    auto take = [&](const uint64_t& count, const uint64_t& size)
+    {
+        if (count > left / size)
+        {
+            return false;
+        }
+
+        left -= count * size;
+        return true;
+    };
+
+    uint64_t rows = header.vertices ? header.vertices + 1 : 0;
+    uint64_t arc_bytes = 2 * sizeof(vertex_type) + sizeof(long long);
+    if (!file || !take(header.vertices, sizeof(size_t)) || !take(rows, sizeof(size_t)) || !take(header.up_arcs, arc_bytes) ||
+        !take(rows, sizeof(size_t)) || !take(header.down_arcs, arc_bytes) || left)
+    {
+        return false;
+    }
+
+    auto read = [&](auto& data, const size_t& size)
+    {
+        data.resize(size);
+        file.read(reinterpret_cast<char*>(data.data()), size * sizeof(data[0]));
+    };
+
+    ContractionHierarchy result;
+    result.shortcuts = header.shortcuts;
+
+    read(result.ranks, header.vertices);
+    for (auto [arcs, count] : {std::pair(&result.up, header.up_arcs), std::pair(&result.down, header.down_arcs)})
+    {
+        read(arcs->offsets, rows);
+        read(arcs->targets, count);
+        read(arcs->weights, count);
+        read(arcs->middles, count);
+    }
+
+    if (!file)
+    {
+        return false;
+    }
+
+    // the queries index with these without checks: every row has to be a range of the arcs, every arc has to
+    // lead to a higher rank and every middle has to rank below both ends, so unpacking always terminates
+    auto& ranks = result.ranks;
+    for (auto [arcs, count] : {std::pair(&result.up, header.up_arcs), std::pair(&result.down, header.down_arcs)})
+    {
+        if (rows ? arcs->offsets.front() != 0 || arcs->offsets.back() != count : count != 0)
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < header.vertices; ++i)
+        {
+            if (arcs->offsets[i] > arcs->offsets[i + 1])
+            {
+                return false;
+            }
+        }
+
+        for (size_t i = 0; i < header.vertices; ++i)
+        {
+            for (size_t pos = arcs->offsets[i]; pos < arcs->offsets[i + 1]; ++pos)
+            {
+                size_t target = arcs->targets[pos];
+                vertex_type middle = arcs->middles[pos];
+                if (target >= header.vertices || ranks[target] <= ranks[i] ||
+                    (middle != none && (middle >= header.vertices || ranks[middle] >= ranks[i])))
+                {
+                    return false;
+                }
+            }
+        }
+    }
+
+    *this = std::move(result);
+
+    return true;
+}
\ No newline at end of file
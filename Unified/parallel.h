@@ -0,0 +1,23 @@
+#ifndef GRAPH_PARALLEL_H
+#define GRAPH_PARALLEL_H
+
+#include <cstddef>
+#include <vector>
+#include <thread>
+#include <algorithm>
+
+// f(first, last) on up to threads slices of [0, size), the calling thread takes the first slice
+template <typename F>
+void parallelFor(const size_t& size, const size_t& threads, F f);
+
+// f(i) for every row of a CSR offsets array, split by entries rather than by rows so a few huge rows
+// don't end up on one thread
+template <typename F>
+void parallelRows(const std::vector<size_t>& offsets, const size_t& threads, F f);
+
+// offsets[i + 1] holds the count of row i on entry and the end of row i on return (offsets[0] stays)
+void prefixSum(std::vector<size_t>& offsets, const size_t& threads);
+
+#include "parallel.hpp"
+
+#endif
\ No newline at end of file
@@ -0,0 +1,79 @@
+template <typename F>
+void parallelFor(const size_t& size, const size_t& threads, F f)
+{
+    size_t count = std::max<size_t>(1, std::min(threads, size));
+
+    std::vector<std::thread> pool;
+    for (size_t t = 1; t < count; ++t)
+    {
+        pool.emplace_back(f, size * t / count, size * (t + 1) / count);
+    }
+
+    f(0, size / count);
+
+    for (auto& thread : pool)
+    {
+        thread.join();
+    }
+}
+
+template <typename F>
+void parallelRows(const std::vector<size_t>& offsets, const size_t& threads, F f)
+{
+    size_t size = offsets.size() - 1;
+    size_t blocks = std::max<size_t>(1, std::min(threads, size));
+
+    std::vector<size_t> bounds(blocks + 1, size);
+    for (size_t b = 0; b < blocks; ++b)
+    {
+        bounds[b] = std::lower_bound(offsets.begin(), offsets.end() - 1, offsets.back() * b / blocks) - offsets.begin();
+    }
+
+    parallelFor(blocks, blocks, [&](const size_t& first, const size_t& last)
+    {
+        for (size_t b = first; b < last; ++b)
+        {
+            for (size_t i = bounds[b]; i < bounds[b + 1]; ++i)
+            {
+                f(i);
+            }
+        }
+    });
+}
+
+inline void prefixSum(std::vector<size_t>& offsets, const size_t& threads)
+{
+    size_t size = offsets.size() - 1;
+    size_t blocks = std::max<size_t>(1, std::min(threads, size));
+
+    // every block sums its counts, the block totals are scanned serially, then every block writes its range
+    std::vector<size_t> sums(blocks + 1, 0);
+    parallelFor(blocks, blocks, [&](const size_t& first, const size_t& last)
+    {
+        for (size_t b = first; b < last; ++b)
+        {
+            for (size_t i = size * b / blocks; i < size * (b + 1) / blocks; ++i)
+            {
+                sums[b + 1] += offsets[i + 1];
+            }
+        }
+    });
+
+    for (size_t b = 0; b < blocks; ++b)
+    {
+        sums[b + 1] += sums[b];
+    }
+
+    parallelFor(blocks, blocks, [&](const size_t& first, const size_t& last)
+    {
+        for (size_t b = first; b < last; ++b)
+        {
+            size_t sum = sums[b];
+            for (size_t i = size * b / blocks; i < size * (b + 1) / blocks; ++i)
+            {
+                sum += offsets[i + 1];
+                offsets[i + 1] = sum;
+            }
+        }
+    });
+}
\ No newline at end of file
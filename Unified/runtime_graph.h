@@ -0,0 +1,150 @@
+#ifndef GRAPH_RUNTIME_H
+#define GRAPH_RUNTIME_H
+
+#include <vector>
+#include <tuple>
+#include <utility>
+#include <string>
+#include <thread>
+
+#include "graph_unified.h"
+
+// BasicGraph with the direction picked at run time by a `mode` flag (true for directed), the interface of the
+// legacy Graph classes. Both instantiations are kept and every call is forwarded to the one mode selects, the
+// other stays empty, so a call costs one branch and the algorithms themselves still see a fixed Directed.
+template <typename Storage, bool Weighted = true>
+class RuntimeGraph
+{
+public:
+    typedef typename Storage::vertex_type vertex_type;
+    typedef typename Storage::weight_type weight_type;
+
+    typedef ::PathTree PathTree;
+    typedef ::SearchResult SearchResult;
+    typedef ::QueueType QueueType;
+
+    typedef RuntimeGraph<CSRStorage<vertex_type, weight_type>, Weighted> CSR;
+    typedef ContractionHierarchy<vertex_type> Hierarchy;
+
+    static constexpr bool weighted = Weighted;
+
+private:
+    template <typename, bool>
+    friend class RuntimeGraph;
+
+    typedef BasicGraph<Storage, Weighted, true> directed_type;
+    typedef BasicGraph<Storage, Weighted, false> undirected_type;
+
+    RuntimeGraph(directed_type&& graph);
+    RuntimeGraph(undirected_type&& graph);
+
+public:
+    RuntimeGraph() = default;
+    RuntimeGraph(const std::vector<std::tuple<size_t, size_t, size_t>>& edges, bool mode = 0);
+    RuntimeGraph(const std::vector<std::tuple<size_t, size_t, size_t>>& edges, bool mode, size_t threads);
+    RuntimeGraph(const std::vector<std::pair<size_t, size_t>>& edges, bool mode = 0);
+    RuntimeGraph(const std::vector<std::pair<size_t, size_t>>& edges, bool mode, size_t threads);
+    RuntimeGraph(const RuntimeGraph& gr) = default;
+    RuntimeGraph(RuntimeGraph&& gr) = default;
+
+    ~RuntimeGraph() = default;
+
+    RuntimeGraph& operator=(const RuntimeGraph& gr) = default;
+    RuntimeGraph& operator=(RuntimeGraph&& gr) = default;
+
+    void addEdge(const size_t& index1, const size_t& index2, const size_t& w = 1) requires EditableStorage<Storage>;
+    void addVertex(const size_t& add_size = 1) requires EditableStorage<Storage>;
+
+    void removeEdge(const size_t& index1, const size_t& index2) requires EditableStorage<Storage>;
+
+    void removeVertex(const size_t& vertex) requires EditableStorage<Storage>;
+    size_t insertVertex() requires EditableStorage<Storage>;
+    std::vector<size_t> compact() requires EditableStorage<Storage>;
+
+    void clear();
+
+    void transpose();
+
+    void trackIncoming(bool enable = true);
+    bool tracksIncoming() const;
+
+    bool isDirected() const;
+
+    size_t vertexCount() const;
+    size_t edgeCount() const;
+
+    std::vector<size_t> liveVertices() const;
+
+    size_t inDegree(const size_t& index) const;
+    std::vector<size_t> predecessors(const size_t& index) const;
+
+    void printDfsIterative(const size_t& index) const;
+    void printDfsRecursive(const size_t& index) const;
+
+    void printBfs(const size_t& index) const;
+
+    // only the weighted graphs ever printed themselves
+    void printGraph() const requires Weighted;
+    std::vector<size_t> printLevelDfs(const size_t& index, const size_t& level) const;
+    std::vector<size_t> printLevelBfs(const size_t& index, size_t level) const;
+
+    std::vector<size_t> getShortPath(const size_t& source, size_t dest) const;
+
+    std::vector<std::vector<size_t>> allPathes(const size_t& source, const size_t& dest) const;
+
+    bool hasCycle() const;
+
+    std::vector<size_t> topoDfs() const;
+    std::vector<size_t> topoKahn() const;
+
+    std::vector<std::vector<size_t>> kosaraju() const;
+    std::vector<std::vector<size_t>> tarjan() const;
+
+    std::vector<long long> SSSP(const size_t& source) const;
+    std::vector<std::pair<std::vector<size_t>, long long>> dijkstra(const size_t& source, QueueType queue = QueueType::Heap) const;
+    PathTree dijkstraTree(const size_t& source, QueueType queue = QueueType::Heap) const;
+    PathTree dijkstraTreeTo(const size_t& target) const;
+    std::vector<size_t> getPath(const PathTree& tree, size_t dest) const;
+
+    std::pair<std::vector<size_t>, long long> shortestPath(const size_t& source, const size_t& target) const;
+
+    template <typename Heuristic>
+    SearchResult astar(const size_t& source, const size_t& target, Heuristic heuristic) const;
+
+    std::vector<std::pair<std::vector<size_t>, long long>> bellmanFord(const size_t& source) const;
+    PathTree bellmanFordTree(const size_t& source, std::vector<size_t>& cycle) const;
+    std::vector<long long> bellmanFordParallel(const size_t& source, size_t threads = std::thread::hardware_concurrency()) const;
+
+    template <typename Callback>
+    bool johnson(Callback callback, size_t threads = std::thread::hardware_concurrency()) const;
+
+    bool johnsonMatrix(std::vector<long long>& distances, size_t threads = std::thread::hardware_concurrency()) const;
+    bool johnsonMatrix(const std::string& path, size_t threads = std::thread::hardware_concurrency()) const;
+
+    std::vector<long long> deltaStepping(const size_t& source, long long delta = 0,
+                                        size_t threads = std::thread::hardware_concurrency()) const;
+
+    RuntimeGraph Prim() const requires EditableStorage<Storage>;
+    RuntimeGraph Kruskal() const requires EditableStorage<Storage>;
+
+    CSR freeze() const;
+
+    Hierarchy contract() const;
+
+    // the storage of the active direction
+    const Storage& getStorage() const;
+
+    void setThresholds(const double& to_matrix, const double& to_list)
+        requires requires (Storage& s, const double& d) { s.setThresholds(d, d); };
+
+    bool save(const std::string& path) const;
+
+private:
+    directed_type directed;
+    undirected_type undirected;
+    bool mode = false;
+};
+
+#include "runtime_graph.hpp"
+
+#endif
\ No newline at end of file
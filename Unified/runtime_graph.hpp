@@ -0,0 +1,348 @@
+template <typename Storage, bool Weighted>
+RuntimeGraph<Storage, Weighted>::RuntimeGraph(directed_type&& graph) : directed(std::move(graph)), mode(true)
+{
+}
+
+template <typename Storage, bool Weighted>
+RuntimeGraph<Storage, Weighted>::RuntimeGraph(undirected_type&& graph) : undirected(std::move(graph)), mode(false)
+{
+}
+
+template <typename Storage, bool Weighted>
+RuntimeGraph<Storage, Weighted>::RuntimeGraph(const std::vector<std::tuple<size_t, size_t, size_t>>& edges, bool mode) : RuntimeGraph(edges, mode, 1)
+{
+}
+
+template <typename Storage, bool Weighted>
+RuntimeGraph<Storage, Weighted>::RuntimeGraph(const std::vector<std::tuple<size_t, size_t, size_t>>& edges, bool mode, size_t threads) : mode(mode)
+{
+    if (mode)
+    {
+        directed = directed_type(edges, threads);
+    }
+    else
+    {
+        undirected = undirected_type(edges, threads);
+    }
+}
+
+template <typename Storage, bool Weighted>
+RuntimeGraph<Storage, Weighted>::RuntimeGraph(const std::vector<std::pair<size_t, size_t>>& edges, bool mode) : RuntimeGraph(edges, mode, 1)
+{
+}
+
+template <typename Storage, bool Weighted>
+RuntimeGraph<Storage, Weighted>::RuntimeGraph(const std::vector<std::pair<size_t, size_t>>& edges, bool mode, size_t threads) : mode(mode)
+{
+    if (mode)
+    {
+        directed = directed_type(edges, threads);
+    }
+    else
+    {
+        undirected = undirected_type(edges, threads);
+    }
+}
+
+template <typename Storage, bool Weighted>
+void RuntimeGraph<Storage, Weighted>::addEdge(const size_t& index1, const size_t& index2, const size_t& w) requires EditableStorage<Storage>
+{
+    mode ? directed.addEdge(index1, index2, w) : undirected.addEdge(index1, index2, w);
+}
+
+template <typename Storage, bool Weighted>
+void RuntimeGraph<Storage, Weighted>::addVertex(const size_t& add_size) requires EditableStorage<Storage>
+{
+    mode ? directed.addVertex(add_size) : undirected.addVertex(add_size);
+}
+
+template <typename Storage, bool Weighted>
+void RuntimeGraph<Storage, Weighted>::removeEdge(const size_t& index1, const size_t& index2) requires EditableStorage<Storage>
+{
+    mode ? directed.removeEdge(index1, index2) : undirected.removeEdge(index1, index2);
+}
+
+template <typename Storage, bool Weighted>
+void RuntimeGraph<Storage, Weighted>::removeVertex(const size_t& vertex) requires EditableStorage<Storage>
+{
+    mode ? directed.removeVertex(vertex) : undirected.removeVertex(vertex);
+}
+
+template <typename Storage, bool Weighted>
+size_t RuntimeGraph<Storage, Weighted>::insertVertex() requires EditableStorage<Storage>
+{
+    return mode ? directed.insertVertex() : undirected.insertVertex();
+}
+
+template <typename Storage, bool Weighted>
+std::vector<size_t> RuntimeGraph<Storage, Weighted>::compact() requires EditableStorage<Storage>
+{
+    return mode ? directed.compact() : undirected.compact();
+}
+
+template <typename Storage, bool Weighted>
+void RuntimeGraph<Storage, Weighted>::clear()
+{
+    mode ? directed.clear() : undirected.clear();
+}
+
+template <typename Storage, bool Weighted>
+void RuntimeGraph<Storage, Weighted>::transpose()
+{
+    mode ? directed.transpose() : undirected.transpose();
+}
+
+template <typename Storage, bool Weighted>
+void RuntimeGraph<Storage, Weighted>::trackIncoming(bool enable)
+{
+    mode ? directed.trackIncoming(enable) : undirected.trackIncoming(enable);
+}
+
+template <typename Storage, bool Weighted>
+bool RuntimeGraph<Storage, Weighted>::tracksIncoming() const
+{
+    return mode ? directed.tracksIncoming() : undirected.tracksIncoming();
+}
+
+template <typename Storage, bool Weighted>
+bool RuntimeGraph<Storage, Weighted>::isDirected() const
+{
+    return mode ? directed.isDirected() : undirected.isDirected();
+}
+
+template <typename Storage, bool Weighted>
+size_t RuntimeGraph<Storage, Weighted>::vertexCount() const
+{
+    return mode ? directed.vertexCount() : undirected.vertexCount();
+}
+
+template <typename Storage, bool Weighted>
+size_t RuntimeGraph<Storage, Weighted>::edgeCount() const
+{
+    return mode ? directed.edgeCount() : undirected.edgeCount();
+}
+
+template <typename Storage, bool Weighted>
+std::vector<size_t> RuntimeGraph<Storage, Weighted>::liveVertices() const
+{
+    return mode ? directed.liveVertices() : undirected.liveVertices();
+}
+
+template <typename Storage, bool Weighted>
+size_t RuntimeGraph<Storage, Weighted>::inDegree(const size_t& index) const
+{
+    return mode ? directed.inDegree(index) : undirected.inDegree(index);
+}
+
+template <typename Storage, bool Weighted>
+std::vector<size_t> RuntimeGraph<Storage, Weighted>::predecessors(const size_t& index) const
+{
+    return mode ? directed.predecessors(index) : undirected.predecessors(index);
+}
+
+template <typename Storage, bool Weighted>
+void RuntimeGraph<Storage, Weighted>::printDfsIterative(const size_t& index) const
+{
+    mode ? directed.printDfsIterative(index) : undirected.printDfsIterative(index);
+}
+
+template <typename Storage, bool Weighted>
+void RuntimeGraph<Storage, Weighted>::printDfsRecursive(const size_t& index) const
+{
+    mode ? directed.printDfsRecursive(index) : undirected.printDfsRecursive(index);
+}
+
+template <typename Storage, bool Weighted>
+void RuntimeGraph<Storage, Weighted>::printBfs(const size_t& index) const
+{
+    mode ? directed.printBfs(index) : undirected.printBfs(index);
+}
+
+template <typename Storage, bool Weighted>
+void RuntimeGraph<Storage, Weighted>::printGraph() const requires Weighted
+{
+    mode ? directed.printGraph() : undirected.printGraph();
+}
+
+template <typename Storage, bool Weighted>
+std::vector<size_t> RuntimeGraph<Storage, Weighted>::printLevelDfs(const size_t& index, const size_t& level) const
+{
+    return mode ? directed.printLevelDfs(index, level) : undirected.printLevelDfs(index, level);
+}
+
+template <typename Storage, bool Weighted>
+std::vector<size_t> RuntimeGraph<Storage, Weighted>::printLevelBfs(const size_t& index, size_t level) const
+{
+    return mode ? directed.printLevelBfs(index, level) : undirected.printLevelBfs(index, level);
+}
+
+template <typename Storage, bool Weighted>
+std::vector<size_t> RuntimeGraph<Storage, Weighted>::getShortPath(const size_t& source, size_t dest) const
+{
+    return mode ? directed.getShortPath(source, dest) : undirected.getShortPath(source, dest);
+}
+
+template <typename Storage, bool Weighted>
+std::vector<std::vector<size_t>> RuntimeGraph<Storage, Weighted>::allPathes(const size_t& source, const size_t& dest) const
+{
+    return mode ? directed.allPathes(source, dest) : undirected.allPathes(source, dest);
+}
+
+template <typename Storage, bool Weighted>
+bool RuntimeGraph<Storage, Weighted>::hasCycle() const
+{
+    return mode ? directed.hasCycle() : undirected.hasCycle();
+}
+
+template <typename Storage, bool Weighted>
+std::vector<size_t> RuntimeGraph<Storage, Weighted>::topoDfs() const
+{
+    return mode ? directed.topoDfs() : undirected.topoDfs();
+}
+
+template <typename Storage, bool Weighted>
+std::vector<size_t> RuntimeGraph<Storage, Weighted>::topoKahn() const
+{
+    return mode ? directed.topoKahn() : undirected.topoKahn();
+}
+
+template <typename Storage, bool Weighted>
+std::vector<std::vector<size_t>> RuntimeGraph<Storage, Weighted>::kosaraju() const
+{
+    return mode ? directed.kosaraju() : undirected.kosaraju();
+}
+
+template <typename Storage, bool Weighted>
+std::vector<std::vector<size_t>> RuntimeGraph<Storage, Weighted>::tarjan() const
+{
+    return mode ? directed.tarjan() : undirected.tarjan();
+}
+
+template <typename Storage, bool Weighted>
+std::vector<long long> RuntimeGraph<Storage, Weighted>::SSSP(const size_t& source) const
+{
+    return mode ? directed.SSSP(source) : undirected.SSSP(source);
+}
+
+template <typename Storage, bool Weighted>
+std::vector<std::pair<std::vector<size_t>, long long>> RuntimeGraph<Storage, Weighted>::dijkstra(const size_t& source, QueueType queue) const
+{
+    return mode ? directed.dijkstra(source, queue) : undirected.dijkstra(source, queue);
+}
+
+template <typename Storage, bool Weighted>
+typename RuntimeGraph<Storage, Weighted>::PathTree RuntimeGraph<Storage, Weighted>::dijkstraTree(const size_t& source, QueueType queue) const
+{
+    return mode ? directed.dijkstraTree(source, queue) : undirected.dijkstraTree(source, queue);
+}
+
+template <typename Storage, bool Weighted>
+typename RuntimeGraph<Storage, Weighted>::PathTree RuntimeGraph<Storage, Weighted>::dijkstraTreeTo(const size_t& target) const
+{
+    return mode ? directed.dijkstraTreeTo(target) : undirected.dijkstraTreeTo(target);
+}
+
+template <typename Storage, bool Weighted>
+std::vector<size_t> RuntimeGraph<Storage, Weighted>::getPath(const PathTree& tree, size_t dest) const
+{
+    return mode ? directed.getPath(tree, dest) : undirected.getPath(tree, dest);
+}
+
+template <typename Storage, bool Weighted>
+std::pair<std::vector<size_t>, long long> RuntimeGraph<Storage, Weighted>::shortestPath(const size_t& source, const size_t& target) const
+{
+    return mode ? directed.shortestPath(source, target) : undirected.shortestPath(source, target);
+}
+
+template <typename Storage, bool Weighted>
+template <typename Heuristic>
+typename RuntimeGraph<Storage, Weighted>::SearchResult RuntimeGraph<Storage, Weighted>::astar(const size_t& source, const size_t& target, Heuristic heuristic) const
+{
+    return mode ? directed.astar(source, target, heuristic) : undirected.astar(source, target, heuristic);
+}
+
+template <typename Storage, bool Weighted>
+std::vector<std::pair<std::vector<size_t>, long long>> RuntimeGraph<Storage, Weighted>::bellmanFord(const size_t& source) const
+{
+    return mode ? directed.bellmanFord(source) : undirected.bellmanFord(source);
+}
+
+template <typename Storage, bool Weighted>
+typename RuntimeGraph<Storage, Weighted>::PathTree RuntimeGraph<Storage, Weighted>::bellmanFordTree(const size_t& source, std::vector<size_t>& cycle) const
+{
+    return mode ? directed.bellmanFordTree(source, cycle) : undirected.bellmanFordTree(source, cycle);
+}
+
+template <typename Storage, bool Weighted>
+std::vector<long long> RuntimeGraph<Storage, Weighted>::bellmanFordParallel(const size_t& source, size_t threads) const
+{
+    return mode ? directed.bellmanFordParallel(source, threads) : undirected.bellmanFordParallel(source, threads);
+}
+
+template <typename Storage, bool Weighted>
+template <typename Callback>
+bool RuntimeGraph<Storage, Weighted>::johnson(Callback callback, size_t threads) const
+{
+    return mode ? directed.johnson(callback, threads) : undirected.johnson(callback, threads);
+}
+
+template <typename Storage, bool Weighted>
+bool RuntimeGraph<Storage, Weighted>::johnsonMatrix(std::vector<long long>& distances, size_t threads) const
+{
+    return mode ? directed.johnsonMatrix(distances, threads) : undirected.johnsonMatrix(distances, threads);
+}
+
+template <typename Storage, bool Weighted>
+bool RuntimeGraph<Storage, Weighted>::johnsonMatrix(const std::string& path, size_t threads) const
+{
+    return mode ? directed.johnsonMatrix(path, threads) : undirected.johnsonMatrix(path, threads);
+}
+
+template <typename Storage, bool Weighted>
+std::vector<long long> RuntimeGraph<Storage, Weighted>::deltaStepping(const size_t& source, long long delta, size_t threads) const
+{
+    return mode ? directed.deltaStepping(source, delta, threads) : undirected.deltaStepping(source, delta, threads);
+}
+
+template <typename Storage, bool Weighted>
+RuntimeGraph<Storage, Weighted> RuntimeGraph<Storage, Weighted>::Prim() const requires EditableStorage<Storage>
+{
+    return mode ? RuntimeGraph(directed.Prim()) : RuntimeGraph(undirected.Prim());
+}
+
+template <typename Storage, bool Weighted>
+RuntimeGraph<Storage, Weighted> RuntimeGraph<Storage, Weighted>::Kruskal() const requires EditableStorage<Storage>
+{
+    return mode ? RuntimeGraph(directed.Kruskal()) : RuntimeGraph(undirected.Kruskal());
+}
+
+template <typename Storage, bool Weighted>
+typename RuntimeGraph<Storage, Weighted>::CSR RuntimeGraph<Storage, Weighted>::freeze() const
+{
+    return mode ? CSR(directed.freeze()) : CSR(undirected.freeze());
+}
+
+template <typename Storage, bool Weighted>
+typename RuntimeGraph<Storage, Weighted>::Hierarchy RuntimeGraph<Storage, Weighted>::contract() const
+{
+    return mode ? directed.contract() : undirected.contract();
+}
+
+template <typename Storage, bool Weighted>
+const Storage& RuntimeGraph<Storage, Weighted>::getStorage() const
+{
+    return mode ? directed.getStorage() : undirected.getStorage();
+}
+
+template <typename Storage, bool Weighted>
+void RuntimeGraph<Storage, Weighted>::setThresholds(const double& to_matrix, const double& to_list)
+    requires requires (Storage& s, const double& d) { s.setThresholds(d, d); }
+{
+    mode ? directed.setThresholds(to_matrix, to_list) : undirected.setThresholds(to_matrix, to_list);
+}
+
+template <typename Storage, bool Weighted>
+bool RuntimeGraph<Storage, Weighted>::save(const std::string& path) const
+{
+    return mode ? directed.save(path) : undirected.save(path);
+}
\ No newline at end of file
@@ -0,0 +1,289 @@
+#ifndef GRAPH_STORAGE_H
+#define GRAPH_STORAGE_H
+
+#include <cstdint>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <type_traits>
+
+#include "bit_set.h"
+#include "parallel.h"
+#include "../Listed_Weighted/flat_adjacency.h"
+
+// Storage policies for the BasicGraph template. Every policy offers the same small interface:
+//   size/resize (growing only), assign(offsets, threads, rows) filling an empty storage in bulk, where rows(i, f)
+//   calls f(target, weight) for the offsets[i + 1] - offsets[i] duplicate-free edges of vertex i in ascending order
+//   set/erase/contains/weight for single edges, degree, edgeCount and clearRow (drops the out-edges of a vertex)
+//   forEach(index, f) calling f(neighbour, weight) for every out-edge, forEachUnvisited(index, visited, f) the same
+//   for the neighbours not in visited at the time they are reached (f may add to visited)
+//   forEachIn(index, f) for every in-edge, scansColumns tells whether that is cheaper than a transposed copy
+//   renumber(mapping, count) keeping the vertices with mapping[i] != -1 under their new ids (mapping keeps the
+//   order of the ids) and dropping the edges into the others, transpose and clear.
+// matrix_layout marks the V x V matrices: BasicGraph removes their vertices at once (higher ids move down) instead
+// of tombstoning them, and printGraph prints them as rows of weights.
+// CSRStorage is read-only and has no resize, set, erase, clearRow or renumber.
+
+// the storages that can be edited in place (everything but CSRStorage), BasicGraph only offers its mutators on them
+template <typename Storage>
+concept EditableStorage = requires (Storage& storage, const typename Storage::weight_type& w)
+{
+    storage.resize(size_t());
+    storage.set(size_t(), size_t(), w);
+    storage.erase(size_t(), size_t());
+    storage.renumber(std::vector<size_t>(), size_t());
+};
+
+// one hash row per vertex: with a map Adjacency (FlatAdjacency) the rows hold neighbour -> weight, with a set
+// (std::unordered_set, SortedAdjacency) they hold neighbours only and every edge weighs 1
+template <typename VertexId = size_t, typename Weight = long long, typename Adjacency = FlatAdjacency<VertexId, Weight>>
+class ListStorage
+{
+public:
+    typedef VertexId vertex_type;
+    typedef Weight weight_type;
+
+    static constexpr bool matrix_layout = false;
+
+    size_t size() const;
+    void resize(const size_t& new_size);
+
+    template <typename Rows>
+    void assign(const std::vector<size_t>& offsets, const size_t& threads, Rows rows);
+
+    void set(const size_t& index1, const size_t& index2, const Weight& w);
+    void erase(const size_t& index1, const size_t& index2);
+
+    bool contains(const size_t& index1, const size_t& index2) const;
+    Weight weight(const size_t& index1, const size_t& index2) const;
+
+    size_t degree(const size_t& index) const;
+    size_t edgeCount() const;
+
+    void clearRow(const size_t& index);
+
+    template <typename F>
+    void forEach(const size_t& index, F&& f) const;
+    template <typename F>
+    void forEachUnvisited(const size_t& index, const BitSet& visited, F&& f) const;
+    template <typename F>
+    void forEachIn(const size_t& index, F&& f) const;
+    bool scansColumns() const;
+
+    void renumber(const std::vector<size_t>& mapping, const size_t& count);
+    void transpose();
+    void clear();
+
+private:
+    static constexpr bool weightless = std::is_same_v<typename Adjacency::value_type, VertexId>;
+
+    std::vector<Adjacency> vec;
+};
+
+// bit-packed adjacency matrix for unweighted graphs, every row is `words` 64-bit words so a traversal masks
+// 64 candidate neighbours against its visited set per instruction, every edge weighs 1
+template <typename VertexId = size_t, typename Weight = long long>
+class BitMatrixStorage
+{
+public:
+    typedef VertexId vertex_type;
+    typedef Weight weight_type;
+
+    static constexpr bool matrix_layout = true;
+
+    size_t size() const;
+    void resize(const size_t& new_size);
+
+    template <typename Rows>
+    void assign(const std::vector<size_t>& offsets, const size_t& threads, Rows rows);
+
+    void set(const size_t& index1, const size_t& index2, const Weight& w);
+    void erase(const size_t& index1, const size_t& index2);
+
+    bool contains(const size_t& index1, const size_t& index2) const;
+    Weight weight(const size_t& index1, const size_t& index2) const;
+
+    size_t degree(const size_t& index) const;
+    size_t edgeCount() const;
+
+    void clearRow(const size_t& index);
+
+    template <typename F>
+    void forEach(const size_t& index, F&& f) const;
+    template <typename F>
+    void forEachUnvisited(const size_t& index, const BitSet& visited, F&& f) const;
+    template <typename F>
+    void forEachIn(const size_t& index, F&& f) const;
+    bool scansColumns() const;
+
+    void renumber(const std::vector<size_t>& mapping, const size_t& count);
+    void transpose();
+    void clear();
+
+private:
+    const uint64_t* row(const size_t& index) const;
+    uint64_t* row(const size_t& index);
+
+    void reshape(const size_t& new_words);
+
+    std::vector<uint64_t> vec; // row-major bit matrix, every row is `words` 64-bit words
+    size_t vertices = 0;
+    size_t words = 0;
+};
+
+// dense weight matrix next to a bit matrix of the edges that exist, so any weight (zero included) is a valid
+// edge and the scans skip empty 64-cell stretches a word at a time
+template <typename VertexId = size_t, typename Weight = long long>
+class MatrixStorage
+{
+public:
+    typedef VertexId vertex_type;
+    typedef Weight weight_type;
+
+    static constexpr bool matrix_layout = true;
+
+    size_t size() const;
+    void resize(const size_t& new_size);
+
+    template <typename Rows>
+    void assign(const std::vector<size_t>& offsets, const size_t& threads, Rows rows);
+
+    void set(const size_t& index1, const size_t& index2, const Weight& w);
+    void erase(const size_t& index1, const size_t& index2);
+
+    bool contains(const size_t& index1, const size_t& index2) const;
+    Weight weight(const size_t& index1, const size_t& index2) const;
+
+    size_t degree(const size_t& index) const;
+    size_t edgeCount() const;
+
+    void clearRow(const size_t& index);
+
+    template <typename F>
+    void forEach(const size_t& index, F&& f) const;
+    template <typename F>
+    void forEachUnvisited(const size_t& index, const BitSet& visited, F&& f) const;
+    template <typename F>
+    void forEachIn(const size_t& index, F&& f) const;
+    bool scansColumns() const;
+
+    void renumber(const std::vector<size_t>& mapping, const size_t& count);
+    void transpose();
+    void clear();
+
+private:
+    std::vector<Weight> vec; // row-major weights, a cell is only meaningful while its bit in present is set
+    BitMatrixStorage<VertexId, Weight> present;
+    size_t vertices = 0;
+    size_t stride = 0; // allocated rows/columns, grows geometrically so adding vertices is amortized O(V)
+    size_t edges = 0;
+};
+
+// Starts as a ListStorage and moves everything into a MatrixStorage once the graph gets dense,
+// moving back when it thins out again. Density is E / V^2, the share of the matrix cells that hold an edge:
+// the matrix is used from `to_matrix` upwards, the list again from `to_list` downwards.
+// The gap between the two keeps a graph that hovers around one threshold from migrating on every edge.
+template <typename VertexId = size_t, typename Weight = long long>
+class HybridStorage
+{
+public:
+    typedef VertexId vertex_type;
+    typedef Weight weight_type;
+
+    static constexpr bool matrix_layout = false;
+
+    size_t size() const;
+    void resize(const size_t& new_size);
+
+    template <typename Rows>
+    void assign(const std::vector<size_t>& offsets, const size_t& threads, Rows rows);
+
+    void set(const size_t& index1, const size_t& index2, const Weight& w);
+    void erase(const size_t& index1, const size_t& index2);
+
+    bool contains(const size_t& index1, const size_t& index2) const;
+    Weight weight(const size_t& index1, const size_t& index2) const;
+
+    size_t degree(const size_t& index) const;
+    size_t edgeCount() const;
+
+    void clearRow(const size_t& index);
+
+    template <typename F>
+    void forEach(const size_t& index, F&& f) const;
+    template <typename F>
+    void forEachUnvisited(const size_t& index, const BitSet& visited, F&& f) const;
+    template <typename F>
+    void forEachIn(const size_t& index, F&& f) const;
+    bool scansColumns() const;
+
+    void renumber(const std::vector<size_t>& mapping, const size_t& count);
+    void transpose();
+    void clear();
+
+    void setThresholds(const double& new_to_matrix, const double& new_to_list);
+    bool isDense() const;
+
+private:
+    void rebalance();
+
+    ListStorage<VertexId, Weight> list;
+    MatrixStorage<VertexId, Weight> matrix;
+    bool dense = false;
+
+    size_t vertices = 0;
+    size_t edges = 0;
+
+    double to_matrix = 0.25;
+    double to_list = 0.0625;
+};
+
+// immutable compressed sparse rows: offsets[i]..offsets[i + 1] is the range of vertex i in targets/weights,
+// rows sorted by target, so every scan is sequential and the visited[] accesses of a traversal stay monotonic
+template <typename VertexId = size_t, typename Weight = long long>
+class CSRStorage
+{
+public:
+    typedef VertexId vertex_type;
+    typedef Weight weight_type;
+
+    static constexpr bool matrix_layout = false;
+
+    size_t size() const;
+
+    template <typename Rows>
+    void assign(const std::vector<size_t>& offsets, const size_t& threads, Rows rows);
+
+    bool contains(const size_t& index1, const size_t& index2) const;
+    Weight weight(const size_t& index1, const size_t& index2) const;
+
+    size_t degree(const size_t& index) const;
+    size_t edgeCount() const;
+
+    template <typename F>
+    void forEach(const size_t& index, F&& f) const;
+    template <typename F>
+    void forEachUnvisited(const size_t& index, const BitSet& visited, F&& f) const;
+    template <typename F>
+    void forEachIn(const size_t& index, F&& f) const;
+    bool scansColumns() const;
+
+    void transpose();
+    void clear();
+
+private:
+    static constexpr size_t npos = static_cast<size_t>(-1); // no such edge
+
+    // position of the edge in targets and weights, npos when absent
+    size_t find(const size_t& index1, const size_t& index2) const;
+
+    std::vector<size_t> offsets;
+    std::vector<VertexId> targets;
+    std::vector<Weight> weights;
+};
+
+#include "storage.hpp"
+
+#endif
\ No newline at end of file
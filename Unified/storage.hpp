@@ -0,0 +1,1041 @@
+template <typename VertexId, typename Weight, typename Adjacency>
+size_t ListStorage<VertexId, Weight, Adjacency>::size() const
+{
+    return vec.size();
+}
+
+template <typename VertexId, typename Weight, typename Adjacency>
+void ListStorage<VertexId, Weight, Adjacency>::resize(const size_t& new_size)
+{
+    vec.resize(new_size);
+}
+
+template <typename VertexId, typename Weight, typename Adjacency>
+template <typename Rows>
+void ListStorage<VertexId, Weight, Adjacency>::assign(const std::vector<size_t>& offsets, const size_t& threads, Rows rows)
+{
+    vec.resize(offsets.size() - 1);
+
+    // rows are disjoint, so every thread fills its own range of vertices with exactly reserved space
+    parallelRows(offsets, threads, [&](const size_t& i)
+    {
+        vec[i].reserve(offsets[i + 1] - offsets[i]);
+        rows(i, [&](const size_t& elem, const Weight& w)
+        {
+            set(i, elem, w);
+        });
+    });
+}
+
+template <typename VertexId, typename Weight, typename Adjacency>
+void ListStorage<VertexId, Weight, Adjacency>::set(const size_t& index1, const size_t& index2, const Weight& w)
+{
+    if constexpr (weightless)
+    {
+        vec[index1].insert(index2);
+    }
+
+    else
+    {
+        vec[index1][index2] = w;
+    }
+}
+
+template <typename VertexId, typename Weight, typename Adjacency>
+void ListStorage<VertexId, Weight, Adjacency>::erase(const size_t& index1, const size_t& index2)
+{
+    vec[index1].erase(index2);
+}
+
+template <typename VertexId, typename Weight, typename Adjacency>
+bool ListStorage<VertexId, Weight, Adjacency>::contains(const size_t& index1, const size_t& index2) const
+{
+    return vec[index1].count(index2);
+}
+
+template <typename VertexId, typename Weight, typename Adjacency>
+Weight ListStorage<VertexId, Weight, Adjacency>::weight(const size_t& index1, const size_t& index2) const
+{
+    if constexpr (weightless)
+    {
+        return vec[index1].count(index2) ? 1 : 0;
+    }
+
+    else
+    {
+        auto it = vec[index1].find(index2);
+        return it == vec[index1].end() ? 0 : it->second;
+    }
+}
+
+template <typename VertexId, typename Weight, typename Adjacency>
+size_t ListStorage<VertexId, Weight, Adjacency>::degree(const size_t& index) const
+{
+    return vec[index].size();
+}
+
+template <typename VertexId, typename Weight, typename Adjacency>
+size_t ListStorage<VertexId, Weight, Adjacency>::edgeCount() const
+{
+    size_t edges_count = 0;
+    for (const auto& elem : vec)
+    {
+        edges_count += elem.size();
+    }
+
+    return edges_count;
+}
+
+template <typename VertexId, typename Weight, typename Adjacency>
+void ListStorage<VertexId, Weight, Adjacency>::clearRow(const size_t& index)
+{
+    vec[index].clear();
+}
+
+template <typename VertexId, typename Weight, typename Adjacency>
+template <typename F>
+void ListStorage<VertexId, Weight, Adjacency>::forEach(const size_t& index, F&& f) const
+{
+    for (auto& elem : vec[index])
+    {
+        if constexpr (weightless)
+        {
+            f(static_cast<size_t>(elem), Weight(1));
+        }
+
+        else
+        {
+            f(static_cast<size_t>(elem.first), elem.second);
+        }
+    }
+}
+
+template <typename VertexId, typename Weight, typename Adjacency>
+template <typename F>
+void ListStorage<VertexId, Weight, Adjacency>::forEachUnvisited(const size_t& index, const BitSet& visited, F&& f) const
+{
+    forEach(index, [&](const size_t& elem, const Weight& w)
+    {
+        if (!visited.test(elem))
+        {
+            f(elem, w);
+        }
+    });
+}
+
+template <typename VertexId, typename Weight, typename Adjacency>
+template <typename F>
+void ListStorage<VertexId, Weight, Adjacency>::forEachIn(const size_t& index, F&& f) const
+{
+    // without a reverse index every row has to be checked for an edge into index
+    for (size_t i = 0; i < vec.size(); ++i)
+    {
+        if (vec[i].count(index))
+        {
+            f(i, weight(i, index));
+        }
+    }
+}
+
+template <typename VertexId, typename Weight, typename Adjacency>
+bool ListStorage<VertexId, Weight, Adjacency>::scansColumns() const
+{
+    return false;
+}
+
+template <typename VertexId, typename Weight, typename Adjacency>
+void ListStorage<VertexId, Weight, Adjacency>::renumber(const std::vector<size_t>& mapping, const size_t& count)
+{
+    std::vector<Adjacency> new_graph(count);
+
+    for (size_t i = 0; i < vec.size(); ++i)
+    {
+        if (mapping[i] != static_cast<size_t>(-1))
+        {
+            new_graph[mapping[i]].reserve(vec[i].size());
+            forEach(i, [&](const size_t& elem, const Weight& w)
+            {
+                if (mapping[elem] == static_cast<size_t>(-1))
+                {
+                    return;
+                }
+
+                if constexpr (weightless)
+                {
+                    new_graph[mapping[i]].insert(mapping[elem]);
+                }
+
+                else
+                {
+                    new_graph[mapping[i]][mapping[elem]] = w;
+                }
+            });
+        }
+    }
+
+    vec = std::move(new_graph);
+}
+
+template <typename VertexId, typename Weight, typename Adjacency>
+void ListStorage<VertexId, Weight, Adjacency>::transpose()
+{
+    ListStorage new_graph;
+    new_graph.resize(vec.size());
+
+    for (size_t i = 0; i < vec.size(); ++i)
+    {
+        forEach(i, [&](const size_t& elem, const Weight& w)
+        {
+            new_graph.set(elem, i, w);
+        });
+    }
+
+    vec = std::move(new_graph.vec);
+}
+
+template <typename VertexId, typename Weight, typename Adjacency>
+void ListStorage<VertexId, Weight, Adjacency>::clear()
+{
+    vec.clear();
+}
+
+template <typename VertexId, typename Weight>
+size_t BitMatrixStorage<VertexId, Weight>::size() const
+{
+    return vertices;
+}
+
+template <typename VertexId, typename Weight>
+const uint64_t* BitMatrixStorage<VertexId, Weight>::row(const size_t& index) const
+{
+    return vec.data() + index * words;
+}
+
+template <typename VertexId, typename Weight>
+uint64_t* BitMatrixStorage<VertexId, Weight>::row(const size_t& index)
+{
+    return vec.data() + index * words;
+}
+
+template <typename VertexId, typename Weight>
+void BitMatrixStorage<VertexId, Weight>::reshape(const size_t& new_words)
+{
+    std::vector<uint64_t> new_vec(vertices * new_words, 0);
+
+    size_t copy = std::min(words, new_words);
+    for (size_t i = 0; i < vertices; ++i)
+    {
+        std::copy(row(i), row(i) + copy, new_vec.data() + i * new_words);
+    }
+
+    vec = std::move(new_vec);
+    words = new_words;
+}
+
+template <typename VertexId, typename Weight>
+void BitMatrixStorage<VertexId, Weight>::resize(const size_t& new_size)
+{
+    size_t new_words = (new_size + 63) >> 6;
+
+    // rows only have to be relaid out once every 64 vertices, otherwise new rows are appended
+    if (new_words != words)
+    {
+        reshape(new_words);
+    }
+
+    vertices = new_size;
+    vec.resize(vertices * words, 0);
+}
+
+template <typename VertexId, typename Weight>
+template <typename Rows>
+void BitMatrixStorage<VertexId, Weight>::assign(const std::vector<size_t>& offsets, const size_t& threads, Rows rows)
+{
+    resize(offsets.size() - 1);
+
+    // every row is its own run of words, so the threads never share one
+    parallelRows(offsets, threads, [&](const size_t& i)
+    {
+        rows(i, [&](const size_t& elem, const Weight&)
+        {
+            row(i)[elem >> 6] |= uint64_t(1) << (elem & 63);
+        });
+    });
+}
+
+template <typename VertexId, typename Weight>
+void BitMatrixStorage<VertexId, Weight>::set(const size_t& index1, const size_t& index2, const Weight&)
+{
+    row(index1)[index2 >> 6] |= uint64_t(1) << (index2 & 63);
+}
+
+template <typename VertexId, typename Weight>
+void BitMatrixStorage<VertexId, Weight>::erase(const size_t& index1, const size_t& index2)
+{
+    row(index1)[index2 >> 6] &= ~(uint64_t(1) << (index2 & 63));
+}
+
+template <typename VertexId, typename Weight>
+bool BitMatrixStorage<VertexId, Weight>::contains(const size_t& index1, const size_t& index2) const
+{
+    return row(index1)[index2 >> 6] >> (index2 & 63) & 1;
+}
+
+template <typename VertexId, typename Weight>
+Weight BitMatrixStorage<VertexId, Weight>::weight(const size_t& index1, const size_t& index2) const
+{
+    return contains(index1, index2) ? 1 : 0;
+}
+
+template <typename VertexId, typename Weight>
+size_t BitMatrixStorage<VertexId, Weight>::degree(const size_t& index) const
+{
+    size_t result = 0;
+    for (size_t w = 0; w < words; ++w)
+    {
+        result += std::popcount(row(index)[w]);
+    }
+
+    return result;
+}
+
+template <typename VertexId, typename Weight>
+size_t BitMatrixStorage<VertexId, Weight>::edgeCount() const
+{
+    size_t edges_count = 0;
+    for (const auto& elem : vec)
+    {
+        edges_count += std::popcount(elem);
+    }
+
+    return edges_count;
+}
+
+template <typename VertexId, typename Weight>
+void BitMatrixStorage<VertexId, Weight>::clearRow(const size_t& index)
+{
+    std::fill(row(index), row(index) + words, 0);
+}
+
+template <typename VertexId, typename Weight>
+template <typename F>
+void BitMatrixStorage<VertexId, Weight>::forEach(const size_t& index, F&& f) const
+{
+    const uint64_t* adj = row(index);
+    for (size_t w = 0; w < words; ++w)
+    {
+        for (uint64_t bits = adj[w]; bits; bits &= bits - 1)
+        {
+            f((w << 6) + std::countr_zero(bits), Weight(1));
+        }
+    }
+}
+
+template <typename VertexId, typename Weight>
+template <typename F>
+void BitMatrixStorage<VertexId, Weight>::forEachUnvisited(const size_t& index, const BitSet& visited, F&& f) const
+{
+    const uint64_t* adj = row(index);
+    for (size_t w = 0; w < words; ++w)
+    {
+        // f may visit more vertices (a recursive DFS does), so visited is re-read for every candidate
+        for (uint64_t bits = adj[w] & ~visited.word(w); bits; bits &= ~visited.word(w))
+        {
+            size_t elem = (w << 6) + std::countr_zero(bits);
+            bits &= bits - 1;
+
+            f(elem, Weight(1));
+        }
+    }
+}
+
+template <typename VertexId, typename Weight>
+template <typename F>
+void BitMatrixStorage<VertexId, Weight>::forEachIn(const size_t& index, F&& f) const
+{
+    for (size_t i = 0; i < vertices; ++i)
+    {
+        if (contains(i, index))
+        {
+            f(i, Weight(1));
+        }
+    }
+}
+
+template <typename VertexId, typename Weight>
+bool BitMatrixStorage<VertexId, Weight>::scansColumns() const
+{
+    // a transposed copy is one bit per cell and keeps the rows word-parallel
+    return false;
+}
+
+template <typename VertexId, typename Weight>
+void BitMatrixStorage<VertexId, Weight>::renumber(const std::vector<size_t>& mapping, const size_t& count)
+{
+    BitMatrixStorage new_graph;
+    new_graph.resize(count);
+
+    for (size_t i = 0; i < vertices; ++i)
+    {
+        if (mapping[i] != static_cast<size_t>(-1))
+        {
+            forEach(i, [&](const size_t& elem, const Weight& w)
+            {
+                if (mapping[elem] != static_cast<size_t>(-1))
+                {
+                    new_graph.set(mapping[i], mapping[elem], w);
+                }
+            });
+        }
+    }
+
+    *this = std::move(new_graph);
+}
+
+template <typename VertexId, typename Weight>
+void BitMatrixStorage<VertexId, Weight>::transpose()
+{
+    std::vector<uint64_t> new_graph(vec.size(), 0);
+
+    for (size_t i = 0; i < vertices; ++i)
+    {
+        forEach(i, [&](const size_t& elem, const Weight&)
+        {
+            new_graph[elem * words + (i >> 6)] |= uint64_t(1) << (i & 63);
+        });
+    }
+
+    vec = std::move(new_graph);
+}
+
+template <typename VertexId, typename Weight>
+void BitMatrixStorage<VertexId, Weight>::clear()
+{
+    vec.clear();
+    vertices = 0;
+    words = 0;
+}
+
+template <typename VertexId, typename Weight>
+size_t MatrixStorage<VertexId, Weight>::size() const
+{
+    return vertices;
+}
+
+template <typename VertexId, typename Weight>
+void MatrixStorage<VertexId, Weight>::resize(const size_t& new_size)
+{
+    if (new_size > stride)
+    {
+        size_t new_stride = std::max(stride * 2, new_size);
+
+        std::vector<Weight> new_vec(new_stride * new_stride, 0);
+        for (size_t i = 0; i < vertices; ++i)
+        {
+            std::memcpy(new_vec.data() + i * new_stride, vec.data() + i * stride, vertices * sizeof(Weight));
+        }
+
+        vec = std::move(new_vec);
+        stride = new_stride;
+    }
+
+    present.resize(new_size);
+    vertices = new_size;
+}
+
+template <typename VertexId, typename Weight>
+template <typename Rows>
+void MatrixStorage<VertexId, Weight>::assign(const std::vector<size_t>& offsets, const size_t& threads, Rows rows)
+{
+    // allocated once, exactly, instead of growing edge by edge
+    present.clear();
+    present.resize(offsets.size() - 1);
+    vertices = offsets.size() - 1;
+    stride = vertices;
+    vec.assign(stride * stride, 0);
+
+    // a row of weights and its run of presence words belong to one thread
+    parallelRows(offsets, threads, [&](const size_t& i)
+    {
+        rows(i, [&](const size_t& elem, const Weight& w)
+        {
+            present.set(i, elem, w);
+            vec[i * stride + elem] = w;
+        });
+    });
+
+    edges = offsets.back();
+}
+
+template <typename VertexId, typename Weight>
+void MatrixStorage<VertexId, Weight>::set(const size_t& index1, const size_t& index2, const Weight& w)
+{
+    if (!present.contains(index1, index2))
+    {
+        present.set(index1, index2, w);
+        ++edges;
+    }
+
+    vec[index1 * stride + index2] = w;
+}
+
+template <typename VertexId, typename Weight>
+void MatrixStorage<VertexId, Weight>::erase(const size_t& index1, const size_t& index2)
+{
+    if (present.contains(index1, index2))
+    {
+        present.erase(index1, index2);
+        --edges;
+    }
+
+    vec[index1 * stride + index2] = 0;
+}
+
+template <typename VertexId, typename Weight>
+bool MatrixStorage<VertexId, Weight>::contains(const size_t& index1, const size_t& index2) const
+{
+    return present.contains(index1, index2);
+}
+
+template <typename VertexId, typename Weight>
+Weight MatrixStorage<VertexId, Weight>::weight(const size_t& index1, const size_t& index2) const
+{
+    // cells without an edge are kept at zero
+    return vec[index1 * stride + index2];
+}
+
+template <typename VertexId, typename Weight>
+size_t MatrixStorage<VertexId, Weight>::degree(const size_t& index) const
+{
+    return present.degree(index);
+}
+
+template <typename VertexId, typename Weight>
+size_t MatrixStorage<VertexId, Weight>::edgeCount() const
+{
+    return edges;
+}
+
+template <typename VertexId, typename Weight>
+void MatrixStorage<VertexId, Weight>::clearRow(const size_t& index)
+{
+    edges -= present.degree(index);
+    present.clearRow(index);
+    std::fill(vec.begin() + index * stride, vec.begin() + index * stride + vertices, 0);
+}
+
+template <typename VertexId, typename Weight>
+template <typename F>
+void MatrixStorage<VertexId, Weight>::forEach(const size_t& index, F&& f) const
+{
+    const Weight* row = vec.data() + index * stride;
+    present.forEach(index, [&](const size_t& elem, const Weight&)
+    {
+        f(elem, row[elem]);
+    });
+}
+
+template <typename VertexId, typename Weight>
+template <typename F>
+void MatrixStorage<VertexId, Weight>::forEachUnvisited(const size_t& index, const BitSet& visited, F&& f) const
+{
+    const Weight* row = vec.data() + index * stride;
+    present.forEachUnvisited(index, visited, [&](const size_t& elem, const Weight&)
+    {
+        f(elem, row[elem]);
+    });
+}
+
+template <typename VertexId, typename Weight>
+template <typename F>
+void MatrixStorage<VertexId, Weight>::forEachIn(const size_t& index, F&& f) const
+{
+    for (size_t i = 0; i < vertices; ++i)
+    {
+        if (present.contains(i, index))
+        {
+            f(i, vec[i * stride + index]);
+        }
+    }
+}
+
+template <typename VertexId, typename Weight>
+bool MatrixStorage<VertexId, Weight>::scansColumns() const
+{
+    return true;
+}
+
+template <typename VertexId, typename Weight>
+void MatrixStorage<VertexId, Weight>::renumber(const std::vector<size_t>& mapping, const size_t& count)
+{
+    // new ids never exceed old ones, so walking the cells in row-major order only ever writes to cells that
+    // were already read and the matrix compacts in place
+    for (size_t i = 0; i < vertices; ++i)
+    {
+        if (mapping[i] == static_cast<size_t>(-1))
+        {
+            continue;
+        }
+
+        for (size_t j = 0; j < vertices; ++j)
+        {
+            if (mapping[j] != static_cast<size_t>(-1))
+            {
+                vec[mapping[i] * stride + mapping[j]] = vec[i * stride + j];
+            }
+        }
+    }
+
+    for (size_t i = 0; i < vertices; ++i)
+    {
+        std::fill(vec.begin() + i * stride + (i < count ? count : 0), vec.begin() + i * stride + vertices, 0);
+    }
+
+    present.renumber(mapping, count);
+    edges = present.edgeCount();
+    vertices = count;
+}
+
+template <typename VertexId, typename Weight>
+void MatrixStorage<VertexId, Weight>::transpose()
+{
+    for (size_t i = 0; i < vertices; ++i)
+    {
+        for (size_t j = i + 1; j < vertices; ++j)
+        {
+            std::swap(vec[i * stride + j], vec[j * stride + i]);
+        }
+    }
+
+    present.transpose();
+}
+
+template <typename VertexId, typename Weight>
+void MatrixStorage<VertexId, Weight>::clear()
+{
+    vec.clear();
+    present.clear();
+    vertices = 0;
+    stride = 0;
+    edges = 0;
+}
+
+template <typename VertexId, typename Weight>
+size_t HybridStorage<VertexId, Weight>::size() const
+{
+    return vertices;
+}
+
+template <typename VertexId, typename Weight>
+void HybridStorage<VertexId, Weight>::resize(const size_t& new_size)
+{
+    if (dense)
+    {
+        matrix.resize(new_size);
+    }
+
+    else
+    {
+        list.resize(new_size);
+    }
+
+    vertices = new_size;
+    rebalance();
+}
+
+template <typename VertexId, typename Weight>
+template <typename Rows>
+void HybridStorage<VertexId, Weight>::assign(const std::vector<size_t>& offsets, const size_t& threads, Rows rows)
+{
+    // the final density is known up front, so the edges go straight into the layout they end up in
+    vertices = offsets.size() - 1;
+    edges = offsets.back();
+    dense = edges >= to_matrix * static_cast<double>(vertices) * vertices;
+
+    if (dense)
+    {
+        matrix.assign(offsets, threads, rows);
+    }
+
+    else
+    {
+        list.assign(offsets, threads, rows);
+    }
+}
+
+template <typename VertexId, typename Weight>
+void HybridStorage<VertexId, Weight>::set(const size_t& index1, const size_t& index2, const Weight& w)
+{
+    if (!contains(index1, index2))
+    {
+        ++edges;
+    }
+
+    if (dense)
+    {
+        matrix.set(index1, index2, w);
+    }
+
+    else
+    {
+        list.set(index1, index2, w);
+    }
+
+    rebalance();
+}
+
+template <typename VertexId, typename Weight>
+void HybridStorage<VertexId, Weight>::erase(const size_t& index1, const size_t& index2)
+{
+    if (!contains(index1, index2))
+    {
+        return;
+    }
+
+    --edges;
+
+    if (dense)
+    {
+        matrix.erase(index1, index2);
+    }
+
+    else
+    {
+        list.erase(index1, index2);
+    }
+
+    rebalance();
+}
+
+template <typename VertexId, typename Weight>
+bool HybridStorage<VertexId, Weight>::contains(const size_t& index1, const size_t& index2) const
+{
+    return dense ? matrix.contains(index1, index2) : list.contains(index1, index2);
+}
+
+template <typename VertexId, typename Weight>
+Weight HybridStorage<VertexId, Weight>::weight(const size_t& index1, const size_t& index2) const
+{
+    return dense ? matrix.weight(index1, index2) : list.weight(index1, index2);
+}
+
+template <typename VertexId, typename Weight>
+size_t HybridStorage<VertexId, Weight>::degree(const size_t& index) const
+{
+    return dense ? matrix.degree(index) : list.degree(index);
+}
+
+template <typename VertexId, typename Weight>
+size_t HybridStorage<VertexId, Weight>::edgeCount() const
+{
+    return edges;
+}
+
+template <typename VertexId, typename Weight>
+void HybridStorage<VertexId, Weight>::clearRow(const size_t& index)
+{
+    edges -= degree(index);
+
+    if (dense)
+    {
+        matrix.clearRow(index);
+    }
+
+    else
+    {
+        list.clearRow(index);
+    }
+
+    rebalance();
+}
+
+template <typename VertexId, typename Weight>
+template <typename F>
+void HybridStorage<VertexId, Weight>::forEach(const size_t& index, F&& f) const
+{
+    if (dense)
+    {
+        matrix.forEach(index, f);
+    }
+
+    else
+    {
+        list.forEach(index, f);
+    }
+}
+
+template <typename VertexId, typename Weight>
+template <typename F>
+void HybridStorage<VertexId, Weight>::forEachUnvisited(const size_t& index, const BitSet& visited, F&& f) const
+{
+    if (dense)
+    {
+        matrix.forEachUnvisited(index, visited, f);
+    }
+
+    else
+    {
+        list.forEachUnvisited(index, visited, f);
+    }
+}
+
+template <typename VertexId, typename Weight>
+template <typename F>
+void HybridStorage<VertexId, Weight>::forEachIn(const size_t& index, F&& f) const
+{
+    if (dense)
+    {
+        matrix.forEachIn(index, f);
+    }
+
+    else
+    {
+        list.forEachIn(index, f);
+    }
+}
+
+template <typename VertexId, typename Weight>
+bool HybridStorage<VertexId, Weight>::scansColumns() const
+{
+    return dense;
+}
+
+template <typename VertexId, typename Weight>
+void HybridStorage<VertexId, Weight>::renumber(const std::vector<size_t>& mapping, const size_t& count)
+{
+    if (dense)
+    {
+        matrix.renumber(mapping, count);
+    }
+
+    else
+    {
+        list.renumber(mapping, count);
+    }
+
+    vertices = count;
+    rebalance();
+}
+
+template <typename VertexId, typename Weight>
+void HybridStorage<VertexId, Weight>::transpose()
+{
+    if (dense)
+    {
+        matrix.transpose();
+    }
+
+    else
+    {
+        list.transpose();
+    }
+}
+
+template <typename VertexId, typename Weight>
+void HybridStorage<VertexId, Weight>::clear()
+{
+    list.clear();
+    matrix.clear();
+    dense = false;
+    vertices = 0;
+    edges = 0;
+}
+
+template <typename VertexId, typename Weight>
+void HybridStorage<VertexId, Weight>::setThresholds(const double& new_to_matrix, const double& new_to_list)
+{
+    to_matrix = new_to_matrix;
+    to_list = std::min(new_to_list, new_to_matrix);
+    rebalance();
+}
+
+template <typename VertexId, typename Weight>
+bool HybridStorage<VertexId, Weight>::isDense() const
+{
+    return dense;
+}
+
+template <typename VertexId, typename Weight>
+void HybridStorage<VertexId, Weight>::rebalance()
+{
+    double cells = static_cast<double>(vertices) * vertices;
+
+    if (!dense && vertices && edges >= to_matrix * cells)
+    {
+        matrix.resize(vertices);
+        for (size_t i = 0; i < vertices; ++i)
+        {
+            list.forEach(i, [&](const size_t& elem, const Weight& w)
+            {
+                matrix.set(i, elem, w);
+            });
+        }
+
+        list.clear();
+        dense = true;
+    }
+
+    else if (dense && edges < to_list * cells)
+    {
+        list.resize(vertices);
+        for (size_t i = 0; i < vertices; ++i)
+        {
+            matrix.forEach(i, [&](const size_t& elem, const Weight& w)
+            {
+                list.set(i, elem, w);
+            });
+        }
+
+        matrix.clear();
+        dense = false;
+    }
+}
+
+template <typename VertexId, typename Weight>
+size_t CSRStorage<VertexId, Weight>::size() const
+{
+    return offsets.empty() ? 0 : offsets.size() - 1;
+}
+
+template <typename VertexId, typename Weight>
+template <typename Rows>
+void CSRStorage<VertexId, Weight>::assign(const std::vector<size_t>& new_offsets, const size_t& threads, Rows rows)
+{
+    offsets = new_offsets;
+    targets.resize(offsets.back());
+    weights.resize(offsets.back());
+
+    parallelRows(offsets, threads, [&](const size_t& i)
+    {
+        size_t pos = offsets[i];
+        rows(i, [&](const size_t& elem, const Weight& w)
+        {
+            targets[pos] = elem;
+            weights[pos] = w;
+            ++pos;
+        });
+    });
+}
+
+template <typename VertexId, typename Weight>
+size_t CSRStorage<VertexId, Weight>::find(const size_t& index1, const size_t& index2) const
+{
+    auto first = targets.begin() + offsets[index1];
+    auto last = targets.begin() + offsets[index1 + 1];
+
+    auto it = std::lower_bound(first, last, index2);
+    return it != last && *it == index2 ? it - targets.begin() : npos;
+}
+
+template <typename VertexId, typename Weight>
+bool CSRStorage<VertexId, Weight>::contains(const size_t& index1, const size_t& index2) const
+{
+    return find(index1, index2) != npos;
+}
+
+template <typename VertexId, typename Weight>
+Weight CSRStorage<VertexId, Weight>::weight(const size_t& index1, const size_t& index2) const
+{
+    size_t pos = find(index1, index2);
+    return pos == npos ? 0 : weights[pos];
+}
+
+template <typename VertexId, typename Weight>
+size_t CSRStorage<VertexId, Weight>::degree(const size_t& index) const
+{
+    return offsets[index + 1] - offsets[index];
+}
+
+template <typename VertexId, typename Weight>
+size_t CSRStorage<VertexId, Weight>::edgeCount() const
+{
+    return targets.size();
+}
+
+template <typename VertexId, typename Weight>
+template <typename F>
+void CSRStorage<VertexId, Weight>::forEach(const size_t& index, F&& f) const
+{
+    for (size_t pos = offsets[index]; pos < offsets[index + 1]; ++pos)
+    {
+        f(static_cast<size_t>(targets[pos]), weights[pos]);
+    }
+}
+
+template <typename VertexId, typename Weight>
+template <typename F>
+void CSRStorage<VertexId, Weight>::forEachUnvisited(const size_t& index, const BitSet& visited, F&& f) const
+{
+    for (size_t pos = offsets[index]; pos < offsets[index + 1]; ++pos)
+    {
+        if (!visited.test(targets[pos]))
+        {
+            f(static_cast<size_t>(targets[pos]), weights[pos]);
+        }
+    }
+}
+
+template <typename VertexId, typename Weight>
+template <typename F>
+void CSRStorage<VertexId, Weight>::forEachIn(const size_t& index, F&& f) const
+{
+    for (size_t i = 0; i < size(); ++i)
+    {
+        size_t pos = find(i, index);
+        if (pos != static_cast<size_t>(-1))
+        {
+            f(i, weights[pos]);
+        }
+    }
+}
+
+template <typename VertexId, typename Weight>
+bool CSRStorage<VertexId, Weight>::scansColumns() const
+{
+    return false;
+}
+
+template <typename VertexId, typename Weight>
+void CSRStorage<VertexId, Weight>::transpose()
+{
+    size_t vertices = size();
+
+    std::vector<size_t> new_offsets(vertices + 1, 0);
+    std::vector<VertexId> new_targets(targets.size());
+    std::vector<Weight> new_weights(weights.size());
+
+    for (size_t pos = 0; pos < targets.size(); ++pos)
+    {
+        ++new_offsets[targets[pos] + 1];
+    }
+
+    for (size_t i = 0; i < vertices; ++i)
+    {
+        new_offsets[i + 1] += new_offsets[i];
+    }
+
+    // sources are visited in ascending order, so the new rows come out sorted as well
+    std::vector<size_t> cursor(new_offsets.begin(), new_offsets.end() - 1);
+    for (size_t i = 0; i < vertices; ++i)
+    {
+        for (size_t pos = offsets[i]; pos < offsets[i + 1]; ++pos)
+        {
+            size_t& dest = cursor[targets[pos]];
+            new_targets[dest] = i;
+            new_weights[dest] = weights[pos];
+            ++dest;
+        }
+    }
+
+    offsets = std::move(new_offsets);
+    targets = std::move(new_targets);
+    weights = std::move(new_weights);
+}
+
+template <typename VertexId, typename Weight>
+void CSRStorage<VertexId, Weight>::clear()
+{
+    offsets.clear();
+    targets.clear();
+    weights.clear();
+}
\ No newline at end of file